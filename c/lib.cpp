@@ -43,13 +43,14 @@ scalar_kind_t to_native_scalar(usearch_scalar_kind_t kind) {
     }
 }
 
-add_result_t add_(index_dense_t* index, usearch_key_t key, void const* vector, scalar_kind_t kind) {
+add_result_t add_(index_dense_t* index, usearch_key_t key, void const* vector, scalar_kind_t kind,
+                  std::size_t thread = index_dense_t::any_thread()) {
     switch (kind) {
-    case scalar_kind_t::f32_k: return index->add(key, (f32_t const*)vector);
-    case scalar_kind_t::f64_k: return index->add(key, (f64_t const*)vector);
-    case scalar_kind_t::f16_k: return index->add(key, (f16_t const*)vector);
-    case scalar_kind_t::i8_k: return index->add(key, (i8_bits_t const*)vector);
-    case scalar_kind_t::b1x8_k: return index->add(key, (b1x8_t const*)vector);
+    case scalar_kind_t::f32_k: return index->add(key, (f32_t const*)vector, thread);
+    case scalar_kind_t::f64_k: return index->add(key, (f64_t const*)vector, thread);
+    case scalar_kind_t::f16_k: return index->add(key, (f16_t const*)vector, thread);
+    case scalar_kind_t::i8_k: return index->add(key, (i8_bits_t const*)vector, thread);
+    case scalar_kind_t::b1x8_k: return index->add(key, (b1x8_t const*)vector, thread);
     default: return add_result_t{}.failed("Unknown scalar kind!");
     }
 }
@@ -65,17 +66,36 @@ bool get_(index_dense_t* index, usearch_key_t key, size_t count, void* vector, s
     }
 }
 
-search_result_t search_(index_dense_t* index, void const* vector, scalar_kind_t kind, size_t n) {
+search_result_t search_(index_dense_t* index, void const* vector, scalar_kind_t kind, size_t n,
+                        std::size_t thread = index_dense_t::any_thread()) {
     switch (kind) {
-    case scalar_kind_t::f32_k: return index->search((f32_t const*)vector, n);
-    case scalar_kind_t::f64_k: return index->search((f64_t const*)vector, n);
-    case scalar_kind_t::f16_k: return index->search((f16_t const*)vector, n);
-    case scalar_kind_t::i8_k: return index->search((i8_bits_t const*)vector, n);
-    case scalar_kind_t::b1x8_k: return index->search((b1x8_t const*)vector, n);
+    case scalar_kind_t::f32_k: return index->search((f32_t const*)vector, n, thread);
+    case scalar_kind_t::f64_k: return index->search((f64_t const*)vector, n, thread);
+    case scalar_kind_t::f16_k: return index->search((f16_t const*)vector, n, thread);
+    case scalar_kind_t::i8_k: return index->search((i8_bits_t const*)vector, n, thread);
+    case scalar_kind_t::b1x8_k: return index->search((b1x8_t const*)vector, n, thread);
     default: return search_result_t().failed("Unknown scalar kind!");
     }
 }
 
+/**
+ *  @brief  Makes sure the index has enough thread contexts for a batch, and optionally, enough capacity.
+ *  @return The number of threads to use, or zero, if the reservation failed.
+ */
+std::size_t reserve_batch_(index_dense_t* index, std::size_t members, std::size_t threads) {
+    if (!threads)
+        threads = std::thread::hardware_concurrency();
+    if (index->limits().threads() >= threads && index->capacity() >= members)
+        return threads;
+    members = (std::max)(index->capacity(), members);
+    return index->reserve(index_limits_t(members, threads)) ? threads : 0;
+}
+
+/// @brief  The number of bytes between packed vectors of the given kind.
+std::size_t packed_stride_(index_dense_t const* index, scalar_kind_t kind) {
+    return divide_round_up<CHAR_BIT>(index->dimensions() * bits_per_scalar(kind));
+}
+
 extern "C" {
 
 USEARCH_EXPORT usearch_index_t usearch_init(usearch_init_options_t* options, usearch_error_t* error) {
@@ -159,6 +179,39 @@ USEARCH_EXPORT void usearch_add(
         *error = result.error.release();
 }
 
+USEARCH_EXPORT void usearch_add_many(                                                        //
+    usearch_index_t index, size_t vectors_count, usearch_key_t const* keys,                    //
+    void const* vectors, size_t vectors_stride, usearch_scalar_kind_t kind, size_t threads, //
+    usearch_error_t* error) {
+
+    assert(index && keys && vectors && error);
+    index_dense_t* native = reinterpret_cast<index_dense_t*>(index);
+    scalar_kind_t native_kind = to_native_scalar(kind);
+    if (!vectors_stride)
+        vectors_stride = packed_stride_(native, native_kind);
+
+    // Grow the capacity geometrically, to amortize the reallocations over many batches
+    std::size_t members = native->size() + vectors_count;
+    threads = reserve_batch_(native, members > native->capacity() ? ceil2(members) : members, threads);
+    if (!threads) {
+        *error = "Out of memory!";
+        return;
+    }
+
+    std::atomic<char const*> atomic_error{nullptr};
+    executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
+        byte_t const* vector = reinterpret_cast<byte_t const*>(vectors) + task_idx * vectors_stride;
+        add_result_t result = add_(native, keys[task_idx], vector, native_kind, thread_idx);
+        if (!result) {
+            atomic_error = result.error.release();
+            return false;
+        }
+        return true;
+    });
+    if (char const* message = atomic_error.load())
+        *error = message;
+}
+
 USEARCH_EXPORT bool usearch_contains(usearch_index_t index, usearch_key_t key, usearch_error_t*) {
     assert(index);
     return reinterpret_cast<index_dense_t*>(index)->contains(key);
@@ -184,6 +237,42 @@ USEARCH_EXPORT size_t usearch_search(
     return result.dump_to(found_keys, found_distances);
 }
 
+USEARCH_EXPORT void usearch_search_many(                                                 //
+    usearch_index_t index, size_t queries_count,                                         //
+    void const* queries, size_t queries_stride, usearch_scalar_kind_t kind,              //
+    size_t results_limit, size_t threads,                                                //
+    usearch_key_t* found_keys, usearch_distance_t* found_distances, size_t* found_counts, //
+    usearch_error_t* error) {
+
+    assert(index && queries && found_keys && found_distances && found_counts && error);
+    index_dense_t* native = reinterpret_cast<index_dense_t*>(index);
+    scalar_kind_t native_kind = to_native_scalar(kind);
+    if (!queries_stride)
+        queries_stride = packed_stride_(native, native_kind);
+
+    threads = reserve_batch_(native, native->capacity(), threads);
+    if (!threads) {
+        *error = "Out of memory!";
+        return;
+    }
+
+    std::atomic<char const*> atomic_error{nullptr};
+    executor_default_t{threads}.dynamic(queries_count, [&](std::size_t thread_idx, std::size_t task_idx) {
+        byte_t const* query = reinterpret_cast<byte_t const*>(queries) + task_idx * queries_stride;
+        search_result_t result = search_(native, query, native_kind, results_limit, thread_idx);
+        if (!result) {
+            found_counts[task_idx] = 0;
+            atomic_error = result.error.release();
+            return false;
+        }
+        found_counts[task_idx] = result.dump_to( //
+            found_keys + task_idx * results_limit, found_distances + task_idx * results_limit);
+        return true;
+    });
+    if (char const* message = atomic_error.load())
+        *error = message;
+}
+
 USEARCH_EXPORT size_t usearch_get(                          //
     usearch_index_t index, usearch_key_t key, size_t count, //
     void* vectors, usearch_scalar_kind_t kind, usearch_error_t*) {
@@ -160,6 +160,45 @@ void test_find_vector(size_t vectors_count, size_t vector_dimension, float const
     printf("Test: Find Vector - PASSED\n");
 }
 
+void test_many_vectors(size_t vectors_count, size_t vector_dimension, float const* data) {
+    printf("Test: Add and Find Many Vectors...\n");
+
+    usearch_index_t idx = NULL;
+    usearch_error_t error = NULL;
+    usearch_init_options_t opts = create_options(vector_dimension);
+    idx = usearch_init(&opts, &error);
+    ASSERT(!error, error);
+
+    // Create the keys and result buffers
+    size_t results_count = 10;
+    size_t threads = 4;
+    usearch_key_t* keys = (usearch_key_t*)malloc(vectors_count * results_count * sizeof(usearch_key_t));
+    float* distances = (float*)malloc(vectors_count * results_count * sizeof(float));
+    size_t* counts = (size_t*)malloc(vectors_count * sizeof(size_t));
+    ASSERT(keys && distances && counts, "Failed to allocate memory");
+    for (size_t i = 0; i < vectors_count; ++i)
+        keys[i] = i;
+
+    // Add all vectors at once, letting the index grow
+    usearch_add_many(idx, vectors_count, keys, data, 0, usearch_scalar_f32_k, threads, &error);
+    ASSERT(!error, error);
+    ASSERT(usearch_size(idx, &error) == vectors_count, error);
+    ASSERT(usearch_contains(idx, vectors_count - 1, &error), error);
+
+    // Find all vectors at once, using an explicit stride
+    usearch_search_many(idx, vectors_count, data, vector_dimension * sizeof(float), usearch_scalar_f32_k, results_count,
+                        threads, keys, distances, counts, &error);
+    ASSERT(!error, error);
+    for (size_t i = 0; i < vectors_count; ++i)
+        ASSERT(counts[i] == (vectors_count < results_count ? vectors_count : results_count), "Vector is missing");
+
+    free(keys);
+    free(distances);
+    free(counts);
+    usearch_free(idx, &error);
+    printf("Test: Add and Find Many Vectors - PASSED\n");
+}
+
 void test_remove_vector(size_t vectors_count, size_t vector_dimension, float const* data) {
     printf("Test: Remove Vector...\n");
 
@@ -283,6 +322,7 @@ int main(int argc, char* argv[]) {
     test_init(vectors_count, vector_dimension);
     test_add_vector(vectors_count, vector_dimension, data);
     test_find_vector(vectors_count, vector_dimension, data);
+    test_many_vectors(vectors_count, vector_dimension, data);
     test_remove_vector(vectors_count, vector_dimension, data);
     test_save_load(vectors_count, vector_dimension, data);
     test_view(vectors_count, vector_dimension, data);
@@ -153,6 +153,23 @@ USEARCH_EXPORT void usearch_add(        //
     usearch_index_t, usearch_key_t key, //
     void const* vector, usearch_scalar_kind_t vector_kind, usearch_error_t* error);
 
+/**
+ *  @brief Adds a batch of vectors with their keys to the index, using multiple threads.
+ *  Must not run concurrently with other calls on the same index. Grows the capacity if needed.
+ *  On failure some of the vectors may have already been added.
+ *  @param[in] vectors_count The number of vectors and keys to add.
+ *  @param[in] keys Array of `vectors_count` keys, one per vector.
+ *  @param[in] vectors Pointer to the first vector of a row-major matrix.
+ *  @param[in] vectors_stride The number of bytes between the starts of consecutive vectors, or zero if packed.
+ *  @param[in] vector_kind The scalar type used in the vectors data.
+ *  @param[in] threads The number of threads to use, or zero for all available cores.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_add_many(                                                //
+    usearch_index_t, size_t vectors_count, usearch_key_t const* keys,                //
+    void const* vectors, size_t vectors_stride, usearch_scalar_kind_t vector_kind, //
+    size_t threads, usearch_error_t* error);
+
 /**
  *  @brief Checks if the index contains a vector with a specific key.
  *  @param[in] key The key to be checked.
@@ -184,6 +201,26 @@ USEARCH_EXPORT size_t usearch_search(                           //
     void const* query_vector, usearch_scalar_kind_t query_kind, //
     size_t count, usearch_key_t* keys, usearch_distance_t* distances, usearch_error_t* error);
 
+/**
+ *  @brief Performs k-Approximate Nearest Neighbors (kANN) Search for a batch of queries, using multiple threads.
+ *  Must not run concurrently with other calls on the same index.
+ *  @param[in] queries_count The number of query vectors.
+ *  @param[in] queries Pointer to the first query vector of a row-major matrix.
+ *  @param[in] queries_stride The number of bytes between the starts of consecutive queries, or zero if packed.
+ *  @param[in] query_kind The scalar type used in the query vectors data.
+ *  @param[in] count Upper bound on the number of neighbors to search per query, the "k" in "kANN".
+ *  @param[in] threads The number of threads to use, or zero for all available cores.
+ *  @param[out] keys Output matrix of `queries_count` rows and `count` columns for the nearest neighbors keys.
+ *  @param[out] distances Output matrix of `queries_count` rows and `count` columns for the distances to them.
+ *  @param[out] counts Output array of `queries_count` numbers of found matches, filling the rows of the matrices.
+ *  @param[out] error Pointer to a string where the error message will be stored, if an error occurs.
+ */
+USEARCH_EXPORT void usearch_search_many(                                          //
+    usearch_index_t, size_t queries_count,                                        //
+    void const* queries, size_t queries_stride, usearch_scalar_kind_t query_kind, //
+    size_t count, size_t threads,                                                 //
+    usearch_key_t* keys, usearch_distance_t* distances, size_t* counts, usearch_error_t* error);
+
 /**
  *  @brief Retrieves the vector associated with the given key from the index.
  *  @param[in] key The key of the vector to retrieve.
@@ -27,10 +27,13 @@
 #include <sys/stat.h> // `stat`
 
 #include <algorithm>
+#include <cmath>     // `std::ceil`
 #include <csignal>
 #include <cstdio>
+#include <fstream>   // `std::ofstream`
 #include <iostream>  // `std::cerr`
 #include <numeric>   // `std::iota`
+#include <random>    // `std::exponential_distribution`
 #include <stdexcept> // `std::invalid_argument`
 #include <string>    // `std::to_string`
 #include <thread>    // `std::thread::hardware_concurrency()`
@@ -277,55 +280,214 @@ struct running_stats_printer_t {
     }
 };
 
-template <typename index_at, typename vector_id_at, typename real_at>
-void index_many(index_at& index, std::size_t n, vector_id_at const* ids, real_at const* vectors, std::size_t dims) {
+/**
+ *  @brief  Log-linear histogram of latencies in nanoseconds, in the spirit of HdrHistogram.
+ *          Every power-of-two range is split into `sub_buckets_k` equal buckets, bounding the
+ *          relative error of percentiles to 1/32, with constant-time recording and a fixed footprint.
+ */
+struct alignas(64) latency_histogram_t {
+    static constexpr std::size_t sub_bits_k = 5;
+    static constexpr std::size_t sub_buckets_k = 1ull << sub_bits_k;
+    static constexpr std::size_t buckets_k = (64 - sub_bits_k + 1) * sub_buckets_k;
+
+    std::uint64_t counts[buckets_k]{};
+    std::uint64_t count{};
+    std::uint64_t sum{};
+    std::uint64_t max{};
+
+    static std::size_t bucket_of(std::uint64_t value) noexcept {
+        if (value < sub_buckets_k)
+            return static_cast<std::size_t>(value);
+        std::size_t exponent = 63;
+        while (!(value >> exponent))
+            --exponent;
+        std::size_t group = exponent - sub_bits_k + 1;
+        std::size_t mantissa = static_cast<std::size_t>(value >> (group - 1));
+        return group * sub_buckets_k + mantissa - sub_buckets_k;
+    }
+
+    /// @brief The middle of the range of values landing in the given bucket.
+    static std::uint64_t value_of(std::size_t bucket) noexcept {
+        if (bucket < sub_buckets_k)
+            return bucket;
+        std::size_t group = bucket / sub_buckets_k;
+        std::uint64_t mantissa = bucket % sub_buckets_k + sub_buckets_k;
+        return (mantissa << (group - 1)) + ((1ull << (group - 1)) >> 1);
+    }
+
+    void record(std::uint64_t nanoseconds) noexcept {
+        counts[bucket_of(nanoseconds)]++;
+        count++;
+        sum += nanoseconds;
+        max = (std::max)(max, nanoseconds);
+    }
+
+    void merge(latency_histogram_t const& other) noexcept {
+        for (std::size_t i = 0; i != buckets_k; ++i)
+            counts[i] += other.counts[i];
+        count += other.count;
+        sum += other.sum;
+        max = (std::max)(max, other.max);
+    }
+
+    std::uint64_t percentile(double share) const noexcept {
+        std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(share * count));
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i != buckets_k; ++i)
+            if ((seen += counts[i]) >= rank && seen)
+                return (std::min)(value_of(i), max);
+        return max;
+    }
+
+    double mean() const noexcept { return count ? double(sum) / count : 0.0; }
+};
+
+/**
+ *  @brief  Summary of a single benchmarked pass: wall-time and merged per-query latencies.
+ */
+struct pass_stats_t {
+    std::string name;
+    double seconds{};
+    latency_histogram_t latencies;
+
+    double per_second() const noexcept { return seconds > 0 ? latencies.count / seconds : 0.0; }
+
+    void print() const {
+        auto us = [&](std::uint64_t nanoseconds) { return nanoseconds / 1e3; };
+        std::printf("Latency: mean %.1f us, p50 %.1f us, p90 %.1f us, p99 %.1f us, p99.9 %.1f us, max %.1f us\n",
+                    latencies.mean() / 1e3, us(latencies.percentile(0.5)), us(latencies.percentile(0.9)),
+                    us(latencies.percentile(0.99)), us(latencies.percentile(0.999)), us(latencies.max));
+    }
+
+    /// @brief Exports the fields of a JSON object, without the surrounding braces.
+    std::string json() const {
+        char buffer[512];
+        std::snprintf(buffer, sizeof(buffer),
+                      "\"name\": \"%s\", \"count\": %llu, \"seconds\": %.6f, \"per_second\": %.1f, "
+                      "\"mean_ns\": %.1f, \"p50_ns\": %llu, \"p90_ns\": %llu, \"p99_ns\": %llu, "
+                      "\"p999_ns\": %llu, \"max_ns\": %llu",
+                      name.c_str(), (unsigned long long)latencies.count, seconds, per_second(), latencies.mean(),
+                      (unsigned long long)latencies.percentile(0.5), (unsigned long long)latencies.percentile(0.9),
+                      (unsigned long long)latencies.percentile(0.99), (unsigned long long)latencies.percentile(0.999),
+                      (unsigned long long)latencies.max);
+        return buffer;
+    }
+};
+
+/**
+ *  @brief  Runs ::callback for every task, recording its latency into a histogram of the calling thread.
+ *          Thread-local histograms are only merged in the end, so that recording never contends.
+ */
+template <typename callback_at>
+pass_stats_t measure_many(char const* name, std::size_t n, std::size_t threads, callback_at&& callback) {
 
-    running_stats_printer_t printer{n, "Indexing"};
+    running_stats_printer_t printer{n, name};
+    std::vector<latency_histogram_t> histograms((std::max)(threads, std::size_t(1)));
+    timestamp_t pass_start = std::chrono::high_resolution_clock::now();
 
 #if USEARCH_USE_OPENMP
 #pragma omp parallel for schedule(static, 32)
 #endif
     for (std::size_t i = 0; i < n; ++i) {
-        index_update_config_t config;
+        std::size_t thread = 0;
 #if USEARCH_USE_OPENMP
-        config.thread = omp_get_thread_num();
+        thread = omp_get_thread_num();
 #endif
-        float_span_t vector{vectors + dims * i, dims};
-        index.add(ids[i], vector, config.thread);
+        timestamp_t start = std::chrono::high_resolution_clock::now();
+        callback(i, thread);
+        timestamp_t end = std::chrono::high_resolution_clock::now();
+        histograms[thread].record(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
         printer.progress++;
-        if (config.thread == 0)
+        if (thread == 0)
             printer.refresh();
     }
+
+    pass_stats_t stats;
+    stats.name = name;
+    stats.seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - pass_start).count();
+    for (latency_histogram_t const& histogram : histograms)
+        stats.latencies.merge(histogram);
+    return stats;
+}
+
+template <typename index_at, typename vector_id_at, typename real_at>
+pass_stats_t index_many(index_at& index, std::size_t n, vector_id_at const* ids, real_at const* vectors,
+                        std::size_t dims) {
+
+    return measure_many("Indexing", n, index.limits().threads(), [&](std::size_t i, std::size_t thread) {
+        float_span_t vector{vectors + dims * i, dims};
+        index.add(ids[i], vector, thread);
+    });
 }
 
 template <typename index_at, typename vector_id_at, typename real_at>
-void search_many( //
+pass_stats_t search_many( //
     index_at& index, std::size_t n, real_at const* vectors, std::size_t dims, std::size_t wanted, vector_id_at* ids,
     real_at* distances) {
 
     std::string name = "Search " + std::to_string(wanted);
-    running_stats_printer_t printer{n, name.c_str()};
-
-#if USEARCH_USE_OPENMP
-#pragma omp parallel for schedule(static, 32)
-#endif
-    for (std::size_t i = 0; i < n; ++i) {
-        index_search_config_t config;
-#if USEARCH_USE_OPENMP
-        config.thread = omp_get_thread_num();
-#endif
+    return measure_many(name.c_str(), n, index.limits().threads(), [&](std::size_t i, std::size_t thread) {
         float_span_t vector{vectors + dims * i, dims};
-        index.search(vector, wanted, config.thread).dump_to(ids + wanted * i, distances + wanted * i);
-        printer.progress++;
-        if (config.thread == 0)
-            printer.refresh();
+        index.search(vector, wanted, thread).dump_to(ids + wanted * i, distances + wanted * i);
+    });
+}
+
+/**
+ *  @brief  Collects the results of all the passes, to be exported as JSON for trend tracking.
+ */
+struct bench_report_t {
+    std::vector<std::string> passes;
+
+    void add(pass_stats_t const& stats, char const* mode, std::string const& extra = {}) {
+        passes.push_back("{" + stats.json() + ", \"mode\": \"" + mode + "\"" + extra + "}");
+    }
+
+    bool save(char const* path, std::string const& header) const {
+        std::ofstream file(path);
+        file << "{" << header << ", \"passes\": [\n";
+        for (std::size_t i = 0; i != passes.size(); ++i)
+            file << "  " << passes[i] << (i + 1 != passes.size() ? ",\n" : "\n");
+        file << "]}\n";
+        return bool(file);
+    }
+};
+
+/**
+ *  @brief  Prints the share of every phase of the index construction, if compiled with `USEARCH_USE_PROFILING`.
+ *  @return Extra JSON fields for the `bench_report_t`, empty if nothing was profiled.
+ */
+template <typename index_at> //
+static std::string print_build_stats(index_at const& index) {
+    index_build_stats_t stats = index.build_stats();
+    if (!stats.insertions || !stats.total_cycles)
+        return {};
+
+    std::uint64_t const phases_cycles =
+        stats.descent_cycles + stats.search_cycles + stats.refine_cycles + stats.reconnect_cycles;
+    std::pair<char const*, std::uint64_t> const phases[] = {
+        {"descent", stats.descent_cycles},
+        {"search", stats.search_cycles},
+        {"refine", stats.refine_cycles},
+        {"reconnect", stats.reconnect_cycles},
+        {"other", stats.total_cycles > phases_cycles ? stats.total_cycles - phases_cycles : 0},
+        {"locks", stats.lock_cycles},
+    };
+
+    double const total = static_cast<double>(stats.total_cycles);
+    std::printf("Construction: %.0f cycles per insertion\n", total / stats.insertions);
+    std::string json = ", \"build_phases\": {";
+    for (std::size_t i = 0; i != sizeof(phases) / sizeof(phases[0]); ++i) {
+        std::printf("-- %-10s %6.2f %%\n", phases[i].first, phases[i].second * 100.0 / total);
+        json += std::string(i ? ", \"" : "\"") + phases[i].first + "\": " + std::to_string(phases[i].second / total);
     }
+    return json + "}";
 }
 
 template <typename dataset_at, typename index_at> //
-static void single_shot(dataset_at& dataset, index_at& index, bool construct = true) {
+static void single_shot(dataset_at& dataset, index_at& index, bench_report_t& report, bool construct = true) {
     using distance_t = typename index_at::distance_t;
     constexpr default_key_t missing_key = std::numeric_limits<default_key_t>::max();
+    char const* mode = construct ? "in-memory" : "view";
 
     std::printf("\n");
     std::printf("------------\n");
@@ -333,14 +495,19 @@ static void single_shot(dataset_at& dataset, index_at& index, bool construct = t
         // Perform insertions, evaluate speed
         std::vector<default_key_t> ids(dataset.vectors_count());
         std::iota(ids.begin(), ids.end(), 0);
-        index_many(index, dataset.vectors_count(), ids.data(), dataset.vector(0), dataset.dimensions());
+        pass_stats_t stats =
+            index_many(index, dataset.vectors_count(), ids.data(), dataset.vector(0), dataset.dimensions());
+        stats.print();
+        report.add(stats, mode, print_build_stats(index));
     }
 
     // Perform search, evaluate speed
     std::vector<default_key_t> found_neighbors(dataset.queries_count() * dataset.neighborhood_size());
     std::vector<distance_t> found_distances(dataset.queries_count() * dataset.neighborhood_size());
-    search_many(index, dataset.queries_count(), dataset.query(0), dataset.dimensions(), dataset.neighborhood_size(),
-                found_neighbors.data(), found_distances.data());
+    pass_stats_t search_stats =
+        search_many(index, dataset.queries_count(), dataset.query(0), dataset.dimensions(),
+                    dataset.neighborhood_size(), found_neighbors.data(), found_distances.data());
+    search_stats.print();
 
     // Evaluate search quality
     std::size_t recall_at_1 = 0, recall_full = 0;
@@ -353,11 +520,15 @@ static void single_shot(dataset_at& dataset, index_at& index, bool construct = t
 
     std::printf("Recall@1 %.2f %%\n", recall_at_1 * 100.f / dataset.queries_count());
     std::printf("Recall %.2f %%\n", recall_full * 100.f / dataset.queries_count());
+    report.add(search_stats, mode,
+               ", \"recall_at_1\": " + std::to_string(recall_at_1 * 1.0 / dataset.queries_count()) +
+                   ", \"recall\": " + std::to_string(recall_full * 1.0 / dataset.queries_count()));
 
     // Perform joins
     std::vector<default_key_t> man_to_woman(dataset.vectors_count());
     std::vector<default_key_t> woman_to_man(dataset.vectors_count());
     std::size_t join_attempts = 0;
+    join_result_t join_result;
     {
         index_at& men = index;
         index_at women = index.copy().index;
@@ -374,6 +545,7 @@ static void single_shot(dataset_at& dataset, index_at& index, bool construct = t
                         printer.print(progress, total);
                 });
             join_attempts = result.visited_members;
+            join_result = std::move(result);
         }
     }
     // Evaluate join quality
@@ -385,6 +557,14 @@ static void single_shot(dataset_at& dataset, index_at& index, bool construct = t
     std::printf("Recall Joins %.2f %%\n", recall_join * 100.f / index.size());
     std::printf("Unmatched %.2f %% (%zu items)\n", unmatched_count * 100.f / index.size(), unmatched_count);
     std::printf("Proposals %.2f / man (%zu total)\n", join_attempts * 1.f / index.size(), join_attempts);
+    std::printf("Rounds %zu\n", join_result.rounds);
+    for (std::size_t i = 0; i != (std::min)(join_result.rounds, join_tracked_rounds()); ++i) {
+        join_round_t const& round = join_result.rounds_stats[i];
+        bool folded = i + 1 == join_tracked_rounds() && join_result.rounds > join_tracked_rounds();
+        double seconds = (std::max)(round.elapsed_ns, std::uint64_t(1)) / 1e9;
+        std::printf("- round %zu%s: %zu proposals, %zu engagements, %.0f proposals/s\n", i + 1, folded ? "+" : "",
+                    round.proposals, round.engagements, round.proposals / seconds);
+    }
 
     std::printf("------------\n");
     std::printf("\n");
@@ -437,6 +617,7 @@ struct args_t {
     std::string path_queries;
     std::string path_neighbors;
     std::string path_output = "last.usearch";
+    std::string path_json;
 
     std::size_t connectivity = default_connectivity();
     std::size_t expansion_add = default_expansion_add();
@@ -446,6 +627,22 @@ struct args_t {
     std::size_t vectors_to_skip = 0;
     std::size_t vectors_to_take = 0;
 
+    double target_qps = 0;
+    double add_qps = 0;
+    double duration = 10;
+    std::size_t clients = 0;
+
+    std::string mix;
+    std::size_t epochs = 10;
+    std::size_t epoch_operations = 100000;
+    std::size_t compact_every = 0;
+
+    std::string sweep_expansions;
+    std::string sweep_wanted = "1,10";
+    std::string sweep_threads;
+    std::string path_csv;
+    bool load = false;
+
     bool help = false;
 
     bool big = false;
@@ -489,8 +686,408 @@ struct args_t {
     }
 };
 
+/**
+ *  @brief  Issues up to ::limit requests on a Poisson schedule with the given ::rate per second until
+ *          the ::deadline, measuring latencies from the scheduled send time, rather than the actual one.
+ *          This way the requests queued behind the slow ones are not omitted from the statistics.
+ */
+template <typename callback_at>
+void open_loop(                                                                                  //
+    double rate, std::size_t limit, std::uint64_t seed,                                          //
+    std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point deadline, //
+    latency_histogram_t& histogram, callback_at&& callback) {
+
+    std::mt19937_64 generator(seed);
+    std::exponential_distribution<double> intervals(rate);
+    std::chrono::duration<double> offset{0};
+    for (std::size_t i = 0; i != limit; ++i) {
+        offset += std::chrono::duration<double>(intervals(generator));
+        auto scheduled = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(offset);
+        if (scheduled >= deadline)
+            break;
+        std::this_thread::sleep_until(scheduled);
+        callback(i);
+        auto finished = std::chrono::steady_clock::now();
+        histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(finished - scheduled).count());
+    }
+}
+
+/**
+ *  @brief  Benchmarks the index under an open-loop load: every client thread issues queries at its share
+ *          of the target QPS, while another thread concurrently inserts copies of the dataset vectors.
+ *          Unlike the closed-loop passes, a slow request doesn't delay the following ones, exposing queueing.
+ */
+template <typename index_at, typename dataset_at> //
+void run_open_loop(dataset_at& dataset, index_at& index, args_t const& args, bench_report_t& report) {
+
+    std::size_t const clients = args.clients ? args.clients : args.threads;
+    std::size_t const wanted = dataset.neighborhood_size();
+    std::size_t const dims = dataset.dimensions();
+    std::size_t const first_key = index.size();
+
+    // Reserve twice the expected number of insertions, which the Poisson process will hardly exceed
+    std::size_t const adds_limit = static_cast<std::size_t>(args.add_qps * args.duration * 2);
+    index.reserve(index_limits_t(index.size() + adds_limit, (std::max)(clients + 1, index.limits().threads())));
+    std::printf("Open-loop: %.0f queries/s from %zu clients, %.0f insertions/s, for %.1f s\n", args.target_qps,
+                clients, args.add_qps, args.duration);
+
+    std::vector<latency_histogram_t> histograms(clients + 1);
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                std::chrono::duration<double>(args.duration));
+
+    std::vector<std::thread> threads;
+    for (std::size_t client = 0; client != clients; ++client)
+        threads.emplace_back([&, client] {
+            std::size_t const limit = std::numeric_limits<std::size_t>::max();
+            open_loop(args.target_qps / clients, limit, client, start, deadline, histograms[client],
+                      [&](std::size_t i) {
+                          std::size_t query = (client + i * clients) % dataset.queries_count();
+                          index.search(float_span_t{dataset.query(query), dims}, wanted, client);
+                      });
+        });
+    if (args.add_qps > 0)
+        threads.emplace_back([&] {
+            open_loop(args.add_qps, adds_limit, clients, start, deadline, histograms[clients], [&](std::size_t i) {
+                float_span_t vector{dataset.vector(i % dataset.vectors_count()), dims};
+                index.add(static_cast<default_key_t>(first_key + i), vector, clients);
+            });
+        });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    pass_stats_t search_stats;
+    search_stats.name = "Open-loop search " + std::to_string(wanted);
+    search_stats.seconds = seconds;
+    for (std::size_t client = 0; client != clients; ++client)
+        search_stats.latencies.merge(histograms[client]);
+    std::printf("%s: %.0f queries/s\n", search_stats.name.c_str(), search_stats.per_second());
+    search_stats.print();
+    report.add(search_stats, "open-loop", ", \"target_per_second\": " + std::to_string(args.target_qps));
+
+    if (args.add_qps > 0) {
+        pass_stats_t add_stats;
+        add_stats.name = "Open-loop indexing";
+        add_stats.seconds = seconds;
+        add_stats.latencies = histograms[clients];
+        std::printf("%s: %.0f vectors/s\n", add_stats.name.c_str(), add_stats.per_second());
+        add_stats.print();
+        report.add(add_stats, "open-loop", ", \"target_per_second\": " + std::to_string(args.add_qps));
+    }
+}
+
+/**
+ *  @brief  Benchmarks a mixed workload of insertions, searches, removals, updates, and renames over several
+ *          epochs, tracking the drift of recall, throughput, and memory usage, as the index churns.
+ *
+ *  Insertions bring back previously removed vectors under their original keys, and updates replace a vector
+ *  with itself, both reusing the freed nodes. Renames move a key to an alias past the end of the dataset,
+ *  and the next rename of the same vector moves it back. Recall@1 is evaluated after every epoch against the
+ *  closest ground-truth neighbor, that is still present in the index. Every key is touched at most once per
+ *  epoch, so that concurrent operations never conflict.
+ */
 template <typename index_at, typename dataset_at> //
-void run_punned(dataset_at& dataset, args_t const& args, index_config_t config, index_limits_t limits) {
+void run_mixed(dataset_at& dataset, index_at& index, args_t const& args, bench_report_t& report) {
+
+    enum operation_kind_t { add_k, search_k, remove_k, update_k, rename_k, operations_kinds_k };
+    struct operation_t {
+        operation_kind_t kind;
+        default_key_t key;    // The row in the dataset
+        default_key_t stored; // The key it is stored under in the index, unless being added
+    };
+
+    // The rename weight is optional, to keep the older four-weight mixes valid
+    std::size_t weights[operations_kinds_k] = {0};
+    int const parsed = std::sscanf(args.mix.c_str(), "%zu:%zu:%zu:%zu:%zu", &weights[add_k], &weights[search_k],
+                                   &weights[remove_k], &weights[update_k], &weights[rename_k]);
+    if ((parsed != 4 && parsed != 5) || !std::accumulate(weights, weights + operations_kinds_k, std::size_t(0))) {
+        std::printf("Error: The mix must be defined as `add:search:remove:update[:rename]` weights, "
+                    "like `10:70:10:5:5`\n");
+        return;
+    }
+
+    // Track which keys are present, to know which ones can be removed or added back
+    std::size_t const vectors_count = dataset.vectors_count();
+    std::size_t const dims = dataset.dimensions();
+    std::vector<default_key_t> present(vectors_count), absent;
+    std::iota(present.begin(), present.end(), default_key_t(0));
+    std::vector<bool> is_present(vectors_count, true);
+    std::vector<bool> is_renamed(vectors_count, false);
+    auto stored_key = [&](default_key_t key) -> default_key_t {
+        return is_renamed[key] ? key + static_cast<default_key_t>(vectors_count) : key;
+    };
+    std::vector<std::size_t> touched_epoch(vectors_count, 0);
+    std::discrete_distribution<int> kinds(weights, weights + operations_kinds_k);
+    std::mt19937_64 generator(42);
+
+    auto pick = [&](std::vector<default_key_t>& keys, std::size_t epoch, bool remove) -> default_key_t {
+        for (std::size_t attempt = 0; attempt != 8 && !keys.empty(); ++attempt) {
+            std::size_t position = generator() % keys.size();
+            default_key_t key = keys[position];
+            if (touched_epoch[key] == epoch)
+                continue;
+            touched_epoch[key] = epoch;
+            if (remove) {
+                keys[position] = keys.back();
+                keys.pop_back();
+            }
+            return key;
+        }
+        return std::numeric_limits<default_key_t>::max();
+    };
+
+    std::vector<operation_t> operations(args.epoch_operations);
+    std::size_t const threads = index.limits().threads();
+    std::vector<latency_histogram_t> histograms(threads * operations_kinds_k);
+    std::size_t const recall_queries = (std::min)(dataset.queries_count(), std::size_t(10000));
+    executor_default_t executor(threads);
+    std::printf("Mixed workload: %s add:search:remove:update:rename, %zu epochs of %zu operations\n", args.mix.c_str(),
+                args.epochs, args.epoch_operations);
+
+    for (std::size_t epoch = 1; epoch <= args.epochs; ++epoch) {
+
+        // Plan the epoch sequentially, updating the set of present keys, and execute it concurrently
+        for (operation_t& operation : operations) {
+            operation.kind = static_cast<operation_kind_t>(kinds(generator));
+            default_key_t key = std::numeric_limits<default_key_t>::max();
+            default_key_t stored = key;
+            switch (operation.kind) {
+            case add_k:
+                if ((key = pick(absent, epoch, true)) != std::numeric_limits<default_key_t>::max())
+                    present.push_back(key), is_present[key] = true, stored = key;
+                break;
+            case remove_k:
+                if ((key = pick(present, epoch, true)) != std::numeric_limits<default_key_t>::max())
+                    absent.push_back(key), is_present[key] = false, stored = stored_key(key), is_renamed[key] = false;
+                break;
+            case update_k:
+                if ((key = pick(present, epoch, false)) != std::numeric_limits<default_key_t>::max())
+                    stored = stored_key(key), is_renamed[key] = false;
+                break;
+            case rename_k:
+                if ((key = pick(present, epoch, false)) != std::numeric_limits<default_key_t>::max())
+                    stored = stored_key(key), is_renamed[key] = !is_renamed[key];
+                break;
+            default: key = static_cast<default_key_t>(generator() % dataset.queries_count()); break;
+            }
+            // Fall back to a search, if no suitable key was found
+            if (key == std::numeric_limits<default_key_t>::max())
+                operation.kind = search_k, key = static_cast<default_key_t>(generator() % dataset.queries_count());
+            operation.key = key;
+            operation.stored = stored;
+        }
+
+        for (latency_histogram_t& histogram : histograms)
+            histogram = latency_histogram_t{};
+        timestamp_t epoch_start = std::chrono::high_resolution_clock::now();
+#if USEARCH_USE_OPENMP
+#pragma omp parallel for schedule(dynamic, 32)
+#endif
+        for (std::size_t i = 0; i < operations.size(); ++i) {
+            std::size_t thread = 0;
+#if USEARCH_USE_OPENMP
+            thread = omp_get_thread_num();
+#endif
+            operation_t const& operation = operations[i];
+            std::size_t const row = static_cast<std::size_t>(operation.key);
+            timestamp_t start = std::chrono::high_resolution_clock::now();
+            switch (operation.kind) {
+            case add_k: index.add(operation.key, float_span_t{dataset.vector(row), dims}, thread); break;
+            case remove_k: index.remove(operation.stored); break;
+            case update_k:
+                index.remove(operation.stored);
+                index.add(operation.key, float_span_t{dataset.vector(row), dims}, thread);
+                break;
+            case rename_k:
+                index.rename(operation.stored, operation.stored == operation.key
+                                                   ? operation.key + static_cast<default_key_t>(vectors_count)
+                                                   : operation.key);
+                break;
+            default: index.search(float_span_t{dataset.query(row), dims}, 1, thread); break;
+            }
+            timestamp_t end = std::chrono::high_resolution_clock::now();
+            histograms[thread * operations_kinds_k + operation.kind].record(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - epoch_start).count();
+
+        double compaction_seconds = 0;
+        if (args.compact_every && epoch % args.compact_every == 0) {
+            timestamp_t compaction_start = std::chrono::high_resolution_clock::now();
+            index.compact(executor);
+            compaction_seconds =
+                std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - compaction_start).count();
+        }
+
+        // Compare with the closest neighbor from the ground-truth, that is still present in the index
+        std::size_t matched = 0, evaluated = 0;
+        for (std::size_t query = 0; query != recall_queries; ++query) {
+            auto expected = dataset.neighborhood(query);
+            auto expected_end = expected + dataset.neighborhood_size();
+            auto closest = std::find_if(expected, expected_end, [&](auto key) {
+                return static_cast<std::size_t>(key) < vectors_count && is_present[key];
+            });
+            if (closest == expected_end)
+                continue;
+            default_key_t found = std::numeric_limits<default_key_t>::max();
+            index.search(float_span_t{dataset.query(query), dims}, 1).dump_to(&found);
+            if (found != std::numeric_limits<default_key_t>::max() && found >= vectors_count)
+                found -= static_cast<default_key_t>(vectors_count);
+            matched += found == static_cast<default_key_t>(*closest);
+            ++evaluated;
+        }
+        double recall = evaluated ? matched * 1.0 / evaluated : 0.0;
+
+        std::printf("Epoch %zu: %.0f operations/s, recall@1 %.2f %%, %zu members, %.1f MB", epoch,
+                    operations.size() / seconds, recall * 100, index.size(), index.memory_usage() / 1e6);
+        if (compaction_seconds)
+            std::printf(", compacted in %.2f s", compaction_seconds);
+        std::printf("\n");
+
+        char const* names[operations_kinds_k] = {"add", "search", "remove", "update", "rename"};
+        for (std::size_t kind = 0; kind != operations_kinds_k; ++kind) {
+            pass_stats_t stats;
+            stats.name = std::string("Mixed ") + names[kind];
+            stats.seconds = seconds;
+            for (std::size_t thread = 0; thread != threads; ++thread)
+                stats.latencies.merge(histograms[thread * operations_kinds_k + kind]);
+            if (!stats.latencies.count)
+                continue;
+            std::printf("-- %-6s %.0f/s, ", names[kind], stats.per_second());
+            stats.print();
+            char extra[256];
+            std::snprintf(extra, sizeof(extra),
+                          ", \"epoch\": %zu, \"recall_at_1\": %.6f, \"members\": %zu, \"memory_bytes\": %zu, "
+                          "\"compaction_seconds\": %.6f",
+                          epoch, recall, index.size(), index.memory_usage(), compaction_seconds);
+            report.add(stats, "mixed", extra);
+        }
+    }
+}
+
+/// @brief Parses a comma-separated list of integers, like "16,32,64".
+std::vector<std::size_t> parse_integers(std::string const& list) {
+    std::vector<std::size_t> result;
+    for (std::size_t begin = 0, end = 0; begin < list.size(); begin = end + 1) {
+        end = list.find(',', begin);
+        end = end == std::string::npos ? list.size() : end;
+        result.push_back(std::stoul(list.substr(begin, end - begin)));
+    }
+    return result;
+}
+
+/**
+ *  @brief  Searches the already constructed ::index with every combination of the expansion factor,
+ *          the number of wanted results and the number of threads, tracing the recall-vs-throughput
+ *          trade-off. The rows are appended to the `--csv` file, to compare different builds.
+ */
+template <typename index_at, typename dataset_at> //
+void run_sweep(dataset_at& dataset, index_at& index, args_t const& args, bench_report_t& report) {
+    using distance_t = typename index_at::distance_t;
+
+    std::vector<std::size_t> expansions = parse_integers(args.sweep_expansions);
+    std::vector<std::size_t> wanted_counts = parse_integers(args.sweep_wanted);
+    std::vector<std::size_t> threads_counts = parse_integers(args.sweep_threads);
+    if (threads_counts.empty())
+        threads_counts.push_back(args.threads);
+#if !USEARCH_USE_OPENMP
+    // Without OpenMP the searches are issued from the calling thread only
+    threads_counts.assign(1, 1);
+#endif
+    std::size_t const max_threads = *std::max_element(threads_counts.begin(), threads_counts.end());
+    std::size_t const max_wanted = *std::max_element(wanted_counts.begin(), wanted_counts.end());
+    index.reserve(index_limits_t(index.size(), (std::max)(max_threads, index.limits().threads())));
+
+    std::size_t const queries_count = dataset.queries_count();
+    std::size_t const initial_expansion = index.expansion_search();
+    std::vector<default_key_t> found_neighbors(queries_count * max_wanted);
+    std::vector<distance_t> found_distances(queries_count * max_wanted);
+
+    struct point_t {
+        std::size_t expansion, wanted, threads;
+        double recall, queries_per_second, p50_us, p99_us;
+        bool pareto;
+    };
+    std::vector<point_t> points;
+    for (std::size_t threads : threads_counts) {
+#if USEARCH_USE_OPENMP
+        omp_set_num_threads(static_cast<int>(threads));
+#endif
+        for (std::size_t wanted : wanted_counts) {
+            for (std::size_t expansion : expansions) {
+                index.change_expansion_search(expansion);
+                std::fill(found_neighbors.begin(), found_neighbors.end(), std::numeric_limits<default_key_t>::max());
+                pass_stats_t stats = search_many(index, queries_count, dataset.query(0), dataset.dimensions(),
+                                                 wanted, found_neighbors.data(), found_distances.data());
+
+                // Recall@k is the share of the `k` true nearest neighbors, found among the `k` results
+                std::size_t const relevant = (std::min)(wanted, dataset.neighborhood_size());
+                std::size_t found = 0;
+                for (std::size_t i = 0; i != queries_count; ++i) {
+                    auto expected = dataset.neighborhood(i);
+                    auto received = found_neighbors.data() + i * wanted;
+                    for (std::size_t j = 0; j != relevant; ++j)
+                        found += contains(received, received + wanted, default_key_t{expected[j]});
+                }
+                double recall = found * 1.0 / (queries_count * relevant);
+                points.push_back({expansion, wanted, threads, recall, stats.per_second(),
+                                  stats.latencies.percentile(0.5) / 1e3, stats.latencies.percentile(0.99) / 1e3,
+                                  false});
+
+                char extra[256];
+                std::snprintf(extra, sizeof(extra),
+                              ", \"expansion_search\": %zu, \"wanted\": %zu, \"threads\": %zu, \"recall\": %f",
+                              expansion, wanted, threads, recall);
+                report.add(stats, "sweep", extra);
+            }
+        }
+    }
+
+#if USEARCH_USE_OPENMP
+    omp_set_num_threads(static_cast<int>(args.threads));
+#endif
+    index.change_expansion_search(initial_expansion);
+
+    // A point is on the Pareto frontier, if no other point with the same `wanted` and `threads`
+    // is at least as good in both the recall and the throughput, and better in one of them
+    for (point_t& point : points) {
+        point.pareto = true;
+        for (point_t const& other : points)
+            if (other.wanted == point.wanted && other.threads == point.threads &&
+                other.recall >= point.recall && other.queries_per_second >= point.queries_per_second &&
+                (other.recall > point.recall || other.queries_per_second > point.queries_per_second))
+                point.pareto = false;
+    }
+
+    // Every pass prints its progress, so the table is only printed in the end
+    std::printf("%10s %7s %8s %9s %14s %10s %10s %7s\n", "Expansion", "Wanted", "Threads", "Recall", "Queries/s",
+                "p50 us", "p99 us", "Pareto");
+    for (point_t const& point : points)
+        std::printf("%10zu %7zu %8zu %8.2f%% %14.0f %10.1f %10.1f %7s\n", point.expansion, point.wanted, point.threads,
+                    point.recall * 100, point.queries_per_second, point.p50_us, point.p99_us,
+                    point.pareto ? "*" : "");
+
+    // Write the header only into new files, so that different configurations can be appended
+    if (args.path_csv.empty())
+        return;
+    bool const fresh = !std::ifstream(args.path_csv).good();
+    std::ofstream csv(args.path_csv, std::ios::app);
+    if (fresh)
+        csv << "metric,quantization,connectivity,expansion_add,expansion_search,wanted,threads,"
+               "recall,queries_per_second,p50_us,p99_us,pareto\n";
+    for (point_t const& point : points)
+        csv << metric_kind_name(index.metric().metric_kind()) << "," << scalar_kind_name(index.scalar_kind()) << ","
+            << index.config().connectivity << "," << index.config().expansion_add << "," << point.expansion << ","
+            << point.wanted << "," << point.threads << "," << point.recall << "," << point.queries_per_second << ","
+            << point.p50_us << "," << point.p99_us << "," << point.pareto << "\n";
+    if (!csv)
+        std::printf("Error: Couldn't write the CSV report to %s\n", args.path_csv.c_str());
+}
+
+template <typename index_at, typename dataset_at> //
+void run_punned(dataset_at& dataset, args_t const& args, index_config_t config, index_limits_t limits,
+                bench_report_t& report) {
 
     scalar_kind_t quantization = args.quantization();
     std::printf("-- Quantization: %s\n", scalar_kind_name(quantization));
@@ -502,33 +1099,73 @@ void run_punned(dataset_at& dataset, args_t const& args, index_config_t config,
     index_at index = index_at::make(metric, config);
     index.reserve(limits);
     std::printf("-- Hardware acceleration: %s\n", isa_name(index.metric().isa_kind()));
+
+    // Sweeps only measure the searches, so the index is constructed once, or loaded from a previous run
+    if (!args.sweep_expansions.empty()) {
+        bool loaded = false;
+        if (args.load) {
+            serialization_result_t loading = index.load(args.path_output.c_str());
+            loaded = bool(loading);
+            if (loaded) {
+                std::printf("Loaded the index from %s\n", args.path_output.c_str());
+            } else {
+                std::printf("Couldn't load the index from %s: %s\n", args.path_output.c_str(),
+                            loading.error.release());
+                // A failed load may leave a partially filled index behind
+                index.reset();
+                index.reserve(limits);
+            }
+        }
+        if (!loaded) {
+            std::vector<default_key_t> ids(dataset.vectors_count());
+            std::iota(ids.begin(), ids.end(), 0);
+            index_many(index, dataset.vectors_count(), ids.data(), dataset.vector(0), dataset.dimensions()).print();
+            print_build_stats(index);
+            index.save(args.path_output.c_str());
+        }
+        std::printf("Will benchmark a recall-vs-QPS sweep\n");
+        run_sweep(dataset, index, args, report);
+        return;
+    }
+
     std::printf("Will benchmark in-memory\n");
 
-    single_shot(dataset, index, true);
+    single_shot(dataset, index, report, true);
     index.save(args.path_output.c_str());
 
     std::printf("Will benchmark an on-disk view\n");
 
     index_at index_view = index.fork().index;
     index_view.view(args.path_output.c_str());
-    single_shot(dataset, index_view, false);
+    single_shot(dataset, index_view, report, false);
+
+    if (args.target_qps > 0) {
+        std::printf("Will benchmark an open-loop load\n");
+        run_open_loop(dataset, index, args, report);
+    }
+
+    if (!args.mix.empty()) {
+        std::printf("Will benchmark a mixed workload\n");
+        run_mixed(dataset, index, args, report);
+    }
 }
 
 template <typename index_at, typename dataset_at> //
-void run_typed(dataset_at& dataset, args_t const& args, index_config_t config, index_limits_t limits) {
+void run_typed(dataset_at& dataset, args_t const& args, index_config_t config, index_limits_t limits,
+               bench_report_t& report) {
 
     index_at index(config);
     index.reserve(limits);
     std::printf("Will benchmark in-memory\n");
 
-    single_shot(dataset, index, true);
+    single_shot(dataset, index, report, true);
     index.save(args.path_output.c_str());
 
     std::printf("Will benchmark an on-disk view\n");
 
     index_at index_view = index.fork();
     index_view.view(args.path_output.c_str());
-    single_shot(dataset, index_view, false);
+    single_shot(dataset, index_view, report, false);
 }
 
 int main(int argc, char** argv) {
@@ -544,6 +1181,7 @@ int main(int argc, char** argv) {
         (option("--queries") & value("path", args.path_queries)).doc(".fbin file path to query the index"),
         (option("--neighbors") & value("path", args.path_neighbors)).doc(".ibin file path with ground truth"),
         (option("-o", "--output") & value("path", args.path_output)).doc(".usearch output file path"),
+        (option("--json") & value("path", args.path_json)).doc(".json file path to export the latencies"),
         (option("-b", "--big").set(args.big)).doc("Will switch to uint40_t for neighbors lists with over 4B entries"),
         (option("-j", "--threads") & value("integer", args.threads)).doc("Uses all available cores by default"),
         (option("-c", "--connectivity") & value("integer", args.connectivity)).doc("Index granularity"),
@@ -551,6 +1189,20 @@ int main(int argc, char** argv) {
         (option("--expansion-search") & value("integer", args.expansion_search)).doc("Affects search depth"),
         (option("--rows-skip") & value("integer", args.vectors_to_skip)).doc("Number of vectors to skip"),
         (option("--rows-take") & value("integer", args.vectors_to_take)).doc("Number of vectors to take"),
+        (option("--qps") & value("number", args.target_qps)).doc("Runs an open-loop load at this queries/s rate"),
+        (option("--add-qps") & value("number", args.add_qps)).doc("Insertions/s rate during the open-loop load"),
+        (option("--clients") & value("integer", args.clients)).doc("Open-loop query threads, same as `--threads`"),
+        (option("--duration") & value("seconds", args.duration)).doc("Duration of the open-loop load"),
+        (option("--mix") & value("a:s:r:u[:n]", args.mix))
+            .doc("Weights of add:search:remove:update[:rename] mixed workload"),
+        (option("--epochs") & value("integer", args.epochs)).doc("Number of epochs in the mixed workload"),
+        (option("--epoch-ops") & value("integer", args.epoch_operations)).doc("Operations per mixed workload epoch"),
+        (option("--compact-every") & value("integer", args.compact_every)).doc("Epochs between compactions"),
+        (option("--sweep") & value("integers", args.sweep_expansions)).doc("Search expansions to sweep, like 16,64"),
+        (option("--sweep-wanted") & value("integers", args.sweep_wanted)).doc("Numbers of results to sweep"),
+        (option("--sweep-threads") & value("integers", args.sweep_threads)).doc("Thread counts to sweep"),
+        (option("--csv") & value("path", args.path_csv)).doc(".csv file path to append the sweep results to"),
+        (option("--load").set(args.load)).doc("Sweep the index from `--output`, instead of constructing it"),
         ( //
             option("-f16", "--f16quant").set(args.quantize_f16).doc("Enable `f16_t` quantization") |
             option("-i8", "--i8quant").set(args.quantize_i8).doc("Enable `i8_t` quantization") |
@@ -613,14 +1265,28 @@ int main(int argc, char** argv) {
     std::printf("-- Expansion @ Add: %zu\n", config.expansion_add);
     std::printf("-- Expansion @ Search: %zu\n", config.expansion_search);
 
+    bench_report_t report;
     if (args.big)
 #ifdef USEARCH_64BIT_ENV
-        run_punned<index_dense_gt<default_key_t, uint40_t>>(dataset, args, config, limits);
+        run_punned<index_dense_gt<default_key_t, uint40_t>>(dataset, args, config, limits, report);
 #else
         std::printf("Error: Don't use 40 bit identifiers in 32bit environment\n");
 #endif
     else
-        run_punned<index_dense_gt<default_key_t, std::uint32_t>>(dataset, args, config, limits);
+        run_punned<index_dense_gt<default_key_t, std::uint32_t>>(dataset, args, config, limits, report);
+
+    if (!args.path_json.empty()) {
+        char header[512];
+        std::snprintf(header, sizeof(header),
+                      "\"dimensions\": %zu, \"vectors\": %zu, \"queries\": %zu, \"threads\": %zu, "
+                      "\"connectivity\": %zu, \"expansion_add\": %zu, \"expansion_search\": %zu, "
+                      "\"metric\": \"%s\", \"quantization\": \"%s\"",
+                      dataset.dimensions(), dataset.vectors_count(), dataset.queries_count(), args.threads,
+                      config.connectivity, config.expansion_add, config.expansion_search,
+                      metric_kind_name(args.metric()), scalar_kind_name(args.quantization()));
+        if (!report.save(args.path_json.c_str(), header))
+            std::printf("Error: Couldn't write the JSON report to %s\n", args.path_json.c_str());
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,238 @@
+/**
+ *  @brief A micro-benchmark for the distance functions behind `metric_punned_t`,
+ *  comparing the type-punned dispatch against direct template calls for every
+ *  metric, scalar type and dimensionality, and reporting the picked instruction set.
+ */
+#include <chrono>   // `std::chrono::steady_clock`
+#include <cstdio>   // `std::printf`
+#include <cstring>  // `std::memset`
+#include <fstream>  // `std::ofstream`
+#include <iostream> // `std::cerr`
+#include <random>   // `std::uniform_real_distribution`
+#include <string>   // `std::stoul`
+#include <vector>
+
+#include <clipp.h> // Command Line Interface
+
+#include <usearch/index_plugins.hpp>
+
+using namespace unum::usearch;
+using namespace unum;
+
+struct args_t {
+    std::string dimensions = "96,256,768,1536";
+    std::string filter;
+    std::string path_json;
+    double seconds = 0.1;
+    std::size_t pool = 64;
+    bool help = false;
+};
+
+/// @brief Speed of one kernel, in the terms of the Google Benchmark JSON reports.
+struct measurement_t {
+    std::string name;
+    std::string isa;
+    std::size_t iterations = 0;
+    double seconds = 0;
+    std::size_t bytes_per_vector = 0;
+
+    double nanoseconds() const noexcept { return seconds * 1e9 / iterations; }
+    double per_second() const noexcept { return iterations / seconds; }
+    double gigabytes_per_second() const noexcept { return per_second() * bytes_per_vector * 2 / 1e9; }
+};
+
+/**
+ *  @brief  Compares every consecutive pair of vectors in the ::pool, doubling the number of iterations,
+ *          until the run is long enough. The pool is small enough to fit in caches, measuring the kernels,
+ *          rather than the memory bandwidth.
+ */
+template <typename metric_at>
+measurement_t measure(metric_at const& metric, std::vector<byte_t> const& pool, std::size_t bytes_per_vector,
+                      double min_seconds) {
+
+    std::size_t const count = pool.size() / bytes_per_vector;
+    measurement_t result;
+    result.bytes_per_vector = bytes_per_vector;
+    volatile double sink = 0;
+    for (std::size_t iterations = 1024;; iterations *= 2) {
+        auto start = std::chrono::steady_clock::now();
+        double sum = 0;
+        for (std::size_t i = 0, j = 0; i != iterations; ++i) {
+            std::size_t k = j + 1 == count ? 0 : j + 1;
+            sum += static_cast<double>(metric(pool.data() + j * bytes_per_vector, pool.data() + k * bytes_per_vector));
+            j = k;
+        }
+        sink = sink + sum;
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.iterations = iterations;
+        if (result.seconds >= min_seconds)
+            break;
+    }
+    return result;
+}
+
+struct report_t {
+    std::vector<measurement_t> measurements;
+
+    void print_header() const {
+        std::printf("%-34s %12s %14s %10s %10s %8s\n", "Benchmark", "Time", "Distances/s", "GB/s", "Overhead", "ISA");
+        std::printf("%s\n", std::string(93, '-').c_str());
+    }
+
+    void add(measurement_t const& direct, measurement_t const& punned) {
+        double overhead = (punned.nanoseconds() - direct.nanoseconds()) / direct.nanoseconds() * 100;
+        std::printf("%-34s %9.2f ns %12.2f M %10.2f %10s %8s\n", direct.name.c_str(), direct.nanoseconds(),
+                    direct.per_second() / 1e6, direct.gigabytes_per_second(), "", "");
+        std::printf("%-34s %9.2f ns %12.2f M %10.2f %9.1f%% %8s\n", punned.name.c_str(), punned.nanoseconds(),
+                    punned.per_second() / 1e6, punned.gigabytes_per_second(), overhead, punned.isa.c_str());
+        measurements.push_back(direct);
+        measurements.push_back(punned);
+    }
+
+    /// @brief Exports the results in the Google Benchmark JSON schema, to reuse its comparison tools.
+    bool save(std::string const& path) const {
+        std::ofstream file(path);
+        file << "{\n  \"context\": {\"library\": \"usearch\"},\n  \"benchmarks\": [";
+        for (std::size_t i = 0; i != measurements.size(); ++i) {
+            measurement_t const& m = measurements[i];
+            file << (i ? "," : "") << "\n    {\"name\": \"" << m.name << "\", \"run_type\": \"iteration\""
+                 << ", \"iterations\": " << m.iterations << ", \"real_time\": " << m.nanoseconds()
+                 << ", \"cpu_time\": " << m.nanoseconds() << ", \"time_unit\": \"ns\""
+                 << ", \"items_per_second\": " << m.per_second()
+                 << ", \"bytes_per_second\": " << m.gigabytes_per_second() * 1e9 << ", \"isa\": \"" << m.isa
+                 << "\"}";
+        }
+        file << "\n  ]\n}\n";
+        return !!file;
+    }
+};
+
+/**
+ *  @brief  Benchmarks one combination of metric, scalar type and dimensionality, both through
+ *          the `metric_punned_t` and calling the `typed_at` template directly.
+ *
+ *  @tparam typed_at The kernel, that `metric_punned_t` falls back to, like `metric_l2sq_gt<f32_t>`.
+ *  @tparam storage_at The scalar type of the vectors, used to generate them from random `f32_t` values.
+ */
+template <typename typed_at, typename storage_at>
+void bench(char const* metric_name, metric_kind_t metric_kind, scalar_kind_t scalar_kind, std::size_t dimensions,
+           args_t const& args, report_t& report) {
+
+    std::string name = std::string(metric_name) + "/" + scalar_kind_name(scalar_kind) + "/" + std::to_string(dimensions);
+    if (!args.filter.empty() && name.find(args.filter) == std::string::npos)
+        return;
+
+    metric_punned_t punned(dimensions, metric_kind, scalar_kind);
+    std::size_t const bytes_per_vector = punned.bytes_per_vector();
+
+    // Bit-sets are generated from zeros and ones, and casts into them only set the bits
+    std::vector<byte_t> pool(args.pool * bytes_per_vector, 0);
+    std::vector<f32_t> original(dimensions);
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<f32_t> distribution(-1, 1);
+    cast_gt<f32_t, storage_at> cast;
+    for (std::size_t i = 0; i != args.pool; ++i) {
+        for (f32_t& value : original)
+            value = scalar_kind == scalar_kind_t::b1x8_k ? f32_t(generator() & 1) : distribution(generator);
+        byte_t* vector = pool.data() + i * bytes_per_vector;
+        if (!cast((byte_t const*)original.data(), dimensions, vector))
+            std::memcpy(vector, original.data(), bytes_per_vector);
+    }
+
+    using scalar_t = typename typed_at::scalar_t;
+    std::size_t const words = bytes_per_vector / sizeof(scalar_t);
+    auto direct_metric = [=](byte_t const* a, byte_t const* b) {
+        return typed_at{}((scalar_t const*)a, (scalar_t const*)b, words);
+    };
+
+    measurement_t direct = measure(direct_metric, pool, bytes_per_vector, args.seconds);
+    measurement_t dispatched = measure(punned, pool, bytes_per_vector, args.seconds);
+    direct.name = name + "/direct";
+    dispatched.name = name + "/punned";
+    dispatched.isa = isa_name(punned.isa_kind());
+    report.add(direct, dispatched);
+}
+
+int main(int argc, char** argv) {
+
+    using namespace clipp;
+
+    auto args = args_t{};
+    auto cli = ( //
+        (option("--dims") & value("integers", args.dimensions)).doc("Comma-separated dimensions to benchmark"),
+        (option("--filter") & value("string", args.filter)).doc("Only run benchmarks, which names contain it"),
+        (option("--seconds") & value("number", args.seconds)).doc("Minimal duration of every benchmark"),
+        (option("--pool") & value("integer", args.pool)).doc("Number of vectors to cycle through"),
+        (option("--json") & value("path", args.path_json)).doc(".json file path in Google Benchmark format"),
+        option("-h", "--help").set(args.help).doc("Print this help information on this tool and exit"));
+
+    if (!parse(argc, argv, cli) || args.pool < 2) {
+        std::cerr << make_man_page(cli, argv[0]);
+        exit(1);
+    }
+    if (args.help) {
+        std::cout << make_man_page(cli, argv[0]);
+        exit(0);
+    }
+
+    std::vector<std::size_t> dimensions;
+    for (std::size_t begin = 0, end = 0; begin < args.dimensions.size(); begin = end + 1) {
+        end = args.dimensions.find(',', begin);
+        end = end == std::string::npos ? args.dimensions.size() : end;
+        dimensions.push_back(std::stoul(args.dimensions.substr(begin, end - begin)));
+    }
+
+    report_t report;
+    report.print_header();
+
+    // Inner Product is only dispatched for `f64` and `f32`, as others are normalized into Cosine
+    for (std::size_t dims : dimensions) {
+        bench<metric_ip_gt<f64_t>, f64_t>("ip", metric_kind_t::ip_k, scalar_kind_t::f64_k, dims, args, report);
+        bench<metric_ip_gt<f32_t>, f32_t>("ip", metric_kind_t::ip_k, scalar_kind_t::f32_k, dims, args, report);
+
+        bench<metric_cos_gt<f64_t>, f64_t>("cos", metric_kind_t::cos_k, scalar_kind_t::f64_k, dims, args, report);
+        bench<metric_cos_gt<f32_t>, f32_t>("cos", metric_kind_t::cos_k, scalar_kind_t::f32_k, dims, args, report);
+        bench<metric_cos_gt<f16_t, f32_t>, f16_t>("cos", metric_kind_t::cos_k, scalar_kind_t::f16_k, dims, args,
+                                                  report);
+        bench<cos_i8_t, i8_bits_t>("cos", metric_kind_t::cos_k, scalar_kind_t::i8_k, dims, args, report);
+
+        bench<metric_l2sq_gt<f64_t>, f64_t>("l2sq", metric_kind_t::l2sq_k, scalar_kind_t::f64_k, dims, args, report);
+        bench<metric_l2sq_gt<f32_t>, f32_t>("l2sq", metric_kind_t::l2sq_k, scalar_kind_t::f32_k, dims, args, report);
+        bench<metric_l2sq_gt<f16_t, f32_t>, f16_t>("l2sq", metric_kind_t::l2sq_k, scalar_kind_t::f16_k, dims, args,
+                                                   report);
+        bench<l2sq_i8_t, i8_bits_t>("l2sq", metric_kind_t::l2sq_k, scalar_kind_t::i8_k, dims, args, report);
+
+        bench<metric_pearson_gt<f64_t>, f64_t>("pearson", metric_kind_t::pearson_k, scalar_kind_t::f64_k, dims, args,
+                                               report);
+        bench<metric_pearson_gt<f32_t>, f32_t>("pearson", metric_kind_t::pearson_k, scalar_kind_t::f32_k, dims, args,
+                                               report);
+        bench<metric_pearson_gt<f16_t, f32_t>, f16_t>("pearson", metric_kind_t::pearson_k, scalar_kind_t::f16_k, dims,
+                                                      args, report);
+        bench<metric_pearson_gt<i8_bits_t, f32_t>, i8_bits_t>("pearson", metric_kind_t::pearson_k,
+                                                              scalar_kind_t::i8_k, dims, args, report);
+
+        // Binary metrics interpret the dimensions as the number of bits
+        bench<metric_hamming_gt<b1x8_t>, b1x8_t>("hamming", metric_kind_t::hamming_k, scalar_kind_t::b1x8_k, dims,
+                                                 args, report);
+        bench<metric_tanimoto_gt<b1x8_t>, b1x8_t>("tanimoto", metric_kind_t::tanimoto_k, scalar_kind_t::b1x8_k, dims,
+                                                  args, report);
+        bench<metric_sorensen_gt<b1x8_t>, b1x8_t>("sorensen", metric_kind_t::sorensen_k, scalar_kind_t::b1x8_k, dims,
+                                                  args, report);
+    }
+
+    // Haversine distance is only defined for latitude and longitude pairs
+    bench<metric_haversine_gt<f64_t>, f64_t>("haversine", metric_kind_t::haversine_k, scalar_kind_t::f64_k, 2, args,
+                                             report);
+    bench<metric_haversine_gt<f32_t>, f32_t>("haversine", metric_kind_t::haversine_k, scalar_kind_t::f32_k, 2, args,
+                                             report);
+    bench<metric_haversine_gt<f16_t, f32_t>, f16_t>("haversine", metric_kind_t::haversine_k, scalar_kind_t::f16_k, 2,
+                                                    args, report);
+    bench<metric_haversine_gt<i8_bits_t, f32_t>, i8_bits_t>("haversine", metric_kind_t::haversine_k,
+                                                            scalar_kind_t::i8_k, 2, args, report);
+
+    if (!args.path_json.empty() && !report.save(args.path_json)) {
+        std::cerr << "Failed to export the results into " << args.path_json << std::endl;
+        return 1;
+    }
+    return 0;
+}
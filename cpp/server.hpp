@@ -0,0 +1,513 @@
+/**
+ *  @brief  A local multi-process server for sharded USearch indexes.
+ *
+ *  Every shard is served by a separate worker process, memory-mapping its own file with `index_dense_gt::view`.
+ *  The router, living in the parent process, talks to the workers over Unix-domain sockets, scattering
+ *  batches of queries to all of them at once, and gathering and merging the top-k results of every query.
+ *
+ *  The wire protocol is a compact binary one, as both ends live on the same machine:
+ *  every message starts with a fixed-size head, followed by raw arrays in host byte order.
+ *
+ *      Handshake: one byte from the worker, non-zero if it has mapped its shard and is ready to serve.
+ *      Request:  `server_request_head_t`, then `queries x bytes_per_vector` query bytes.
+ *      Response: `server_response_head_t`, then `queries` counts, `queries x wanted` keys and distances,
+ *                or `error_length` bytes of the error message, if the `status` is non-zero.
+ */
+#pragma once
+#include <errno.h>      // `errno`
+#include <signal.h>     // `kill`
+#include <sys/socket.h> // `socket`, `bind`, `listen`
+#include <sys/un.h>     // `sockaddr_un`
+#include <sys/wait.h>   // `waitpid`
+#include <unistd.h>     // `fork`, `close`
+
+#include <cstring> // `std::memcpy`
+#include <string>  // `std::string`
+#include <vector>  // `std::vector`
+
+#include <usearch/index_dense.hpp>
+
+namespace unum {
+namespace usearch {
+
+enum class server_opcode_t : std::uint32_t {
+    unknown_k = 0,
+    search_k = 1,
+    size_k = 2,
+    shutdown_k = 3,
+};
+
+struct server_request_head_t {
+    server_opcode_t opcode = server_opcode_t::unknown_k;
+    scalar_kind_t scalar_kind = scalar_kind_t::unknown_k;
+    std::uint64_t queries = 0;
+    std::uint64_t wanted = 0;
+    std::uint64_t dimensions = 0;
+};
+
+struct server_response_head_t {
+    std::uint32_t status = 0;
+    std::uint32_t error_length = 0;
+    std::uint64_t queries = 0;
+    std::uint64_t wanted = 0;
+    /// @brief Total number of entries in the shard, for `server_opcode_t::size_k` requests.
+    std::uint64_t size = 0;
+};
+
+/**
+ *  @brief  Reads exactly ::length bytes from a socket, retrying on partial reads and interrupts.
+ *  @return `false` if the peer has closed the connection or an error occurred.
+ */
+inline bool server_read(int socket, void* buffer, std::size_t length) noexcept {
+    byte_t* tail = reinterpret_cast<byte_t*>(buffer);
+    while (length) {
+        ssize_t received = ::recv(socket, tail, length, 0);
+        if (received < 0 && errno == EINTR)
+            continue;
+        if (received <= 0)
+            return false;
+        tail += received, length -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+
+/**
+ *  @brief  Writes exactly ::length bytes into a socket, retrying on partial writes and interrupts.
+ *  @return `false` if the peer has closed the connection or an error occurred.
+ */
+inline bool server_write(int socket, void const* buffer, std::size_t length) noexcept {
+    byte_t const* tail = reinterpret_cast<byte_t const*>(buffer);
+    while (length) {
+        ssize_t sent = ::send(socket, tail, length, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR)
+            continue;
+        if (sent <= 0)
+            return false;
+        tail += sent, length -= static_cast<std::size_t>(sent);
+    }
+    return true;
+}
+
+/**
+ *  @brief  Serves a single memory-mapped shard to a single router connection.
+ *
+ *  @tparam key_at
+ *      The type of primary objects stored in the index.
+ *
+ *  @tparam compressed_slot_at
+ *      The smallest unsigned integer type to address indexed elements within the shard.
+ */
+template <typename key_at = default_key_t, typename compressed_slot_at = std::uint32_t> //
+class server_worker_gt {
+  public:
+    using key_t = key_at;
+    using compressed_slot_t = compressed_slot_at;
+    using distance_t = distance_punned_t;
+    using index_t = index_dense_gt<key_t, compressed_slot_t>;
+
+  private:
+    index_t index_;
+    std::size_t threads_ = 1;
+
+    std::vector<byte_t> queries_;
+    std::vector<std::uint64_t> counts_;
+    std::vector<key_t> keys_;
+    std::vector<distance_t> distances_;
+
+  public:
+    /**
+     *  @brief  Memory-maps the shard file, without loading it into RAM.
+     *  @param[in] path The path to the shard file, produced by `index_dense_gt::save`.
+     *  @param[in] threads The number of threads to search every batch with.
+     *          Capped by the number of thread contexts the viewed index was reserved with.
+     */
+    serialization_result_t view(char const* path, std::size_t threads = 1) {
+        serialization_result_t result;
+        index_dense_metadata_result_t meta = index_dense_metadata(path);
+        if (!meta)
+            return result.failed(std::move(meta.error));
+
+        metric_punned_t metric(meta.head.dimensions, meta.head.kind_metric, meta.head.kind_scalar);
+        index_ = index_t::make(metric);
+        if (!index_)
+            return result.failed("Out of memory!");
+        result = index_.view(path);
+        if (!result)
+            return result;
+        threads_ = (std::max<std::size_t>)(1, (std::min)(threads, index_.limits().threads()));
+        return result;
+    }
+
+    index_t const& index() const noexcept { return index_; }
+
+    /**
+     *  @brief  Answers requests from the router until it disconnects or asks to shut down.
+     *  @param[in] connection The connected socket.
+     *  @return `true` if the router has asked the worker to shut down.
+     */
+    bool serve(int connection) {
+        server_request_head_t request;
+        while (server_read(connection, &request, sizeof(request))) {
+            switch (request.opcode) {
+            case server_opcode_t::shutdown_k: return true;
+            case server_opcode_t::size_k: {
+                server_response_head_t response;
+                response.size = index_.size();
+                if (!server_write(connection, &response, sizeof(response)))
+                    return false;
+                break;
+            }
+            case server_opcode_t::search_k:
+                if (!search_(connection, request))
+                    return false;
+                break;
+            default: return false;
+            }
+        }
+        return false;
+    }
+
+  private:
+    bool fail_(int connection, char const* message) {
+        server_response_head_t response;
+        response.status = 1;
+        response.error_length = static_cast<std::uint32_t>(std::strlen(message));
+        return server_write(connection, &response, sizeof(response)) &&
+               server_write(connection, message, response.error_length);
+    }
+
+    bool search_(int connection, server_request_head_t const& request) {
+
+        // The payload must be consumed even if the request is invalid, to keep the stream in sync
+        std::size_t bytes_per_vector = divide_round_up<CHAR_BIT>( //
+            static_cast<std::size_t>(request.dimensions) * bits_per_scalar(request.scalar_kind));
+        std::size_t const queries = static_cast<std::size_t>(request.queries);
+        std::size_t const wanted = static_cast<std::size_t>(request.wanted);
+        queries_.resize(queries * bytes_per_vector);
+        if (!server_read(connection, queries_.data(), queries_.size()))
+            return false;
+        if (request.dimensions != index_.dimensions())
+            return fail_(connection, "Dimensions of queries and the shard don't match");
+
+        counts_.resize(queries);
+        keys_.resize(queries * wanted);
+        distances_.resize(queries * wanted);
+
+        executor_default_t executor(threads_);
+        std::atomic<char const*> atomic_error{nullptr};
+        executor.dynamic(queries, [&](std::size_t thread, std::size_t query) {
+            byte_t const* vector = queries_.data() + query * bytes_per_vector;
+            typename index_t::search_result_t result;
+            switch (request.scalar_kind) {
+            case scalar_kind_t::f64_k: result = index_.search((f64_t const*)vector, wanted, thread); break;
+            case scalar_kind_t::f32_k: result = index_.search((f32_t const*)vector, wanted, thread); break;
+            case scalar_kind_t::f16_k: result = index_.search((f16_t const*)vector, wanted, thread); break;
+            case scalar_kind_t::i8_k: result = index_.search((i8_bits_t const*)vector, wanted, thread); break;
+            case scalar_kind_t::b1x8_k: result = index_.search((b1x8_t const*)vector, wanted, thread); break;
+            default: atomic_error = "Unsupported scalar type"; return false;
+            }
+            if (!result) {
+                atomic_error = result.error.release();
+                return false;
+            }
+            counts_[query] = result.dump_to(keys_.data() + query * wanted, distances_.data() + query * wanted);
+            return true;
+        });
+        if (atomic_error)
+            return fail_(connection, atomic_error.load());
+
+        server_response_head_t response;
+        response.queries = queries;
+        response.wanted = wanted;
+        response.size = index_.size();
+        return server_write(connection, &response, sizeof(response)) &&
+               server_write(connection, counts_.data(), counts_.size() * sizeof(std::uint64_t)) &&
+               server_write(connection, keys_.data(), keys_.size() * sizeof(key_t)) &&
+               server_write(connection, distances_.data(), distances_.size() * sizeof(distance_t));
+    }
+};
+
+/**
+ *  @brief  Spawns a worker process per shard, and scatters queries across them.
+ *          Not thread-safe: every router owns one connection per worker, used by one batch at a time.
+ *
+ *  @tparam key_at
+ *      The type of primary objects stored in the index.
+ *
+ *  @tparam compressed_slot_at
+ *      The smallest unsigned integer type to address indexed elements within each shard.
+ */
+template <typename key_at = default_key_t, typename compressed_slot_at = std::uint32_t> //
+class server_router_gt {
+  public:
+    using key_t = key_at;
+    using compressed_slot_t = compressed_slot_at;
+    using distance_t = distance_punned_t;
+    using worker_t = server_worker_gt<key_t, compressed_slot_t>;
+
+    struct search_result_t {
+        error_t error{};
+        /** @brief  Number of queries answered. */
+        std::size_t queries{};
+        /** @brief  Number of shards the queries were scattered to. */
+        std::size_t shards{};
+
+        explicit operator bool() const noexcept { return !error; }
+        search_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+  private:
+    std::vector<int> connections_;
+    std::vector<pid_t> workers_;
+
+    std::vector<std::uint64_t> shard_counts_;
+    std::vector<key_t> shard_keys_;
+    std::vector<distance_t> shard_distances_;
+
+    /// @brief Error message of the last failed worker, referenced by the returned `search_result_t`.
+    std::string worker_error_;
+
+  public:
+    server_router_gt() = default;
+    server_router_gt(server_router_gt&& other) { swap(other); }
+    server_router_gt& operator=(server_router_gt&& other) {
+        swap(other);
+        return *this;
+    }
+    ~server_router_gt() { shutdown(); }
+
+    void swap(server_router_gt& other) {
+        std::swap(connections_, other.connections_);
+        std::swap(workers_, other.workers_);
+    }
+
+    explicit operator bool() const noexcept { return !connections_.empty(); }
+    std::size_t shards() const noexcept { return connections_.size(); }
+
+    /**
+     *  @brief  Forks a worker process for every shard file, connecting to each over a Unix-domain socket.
+     *          The listening sockets are bound before forking, so the router never races the workers.
+     *          Every worker reports, whether it has mapped its shard, once all of them are forked.
+     *
+     *  @param[in] shards_paths The paths to the shard files, one worker per file.
+     *  @param[in] sockets_prefix The prefix for the socket paths, suffixed with the shard index.
+     *  @param[in] threads The number of threads every worker searches its batches with.
+     *  @return An instance of ::server_router_gt, empty if any worker failed to start.
+     */
+    static server_router_gt spawn(                    //
+        std::vector<std::string> const& shards_paths, //
+        std::string const& sockets_prefix,            //
+        std::size_t threads = 1) {
+
+        server_router_gt router;
+        for (std::size_t shard = 0; shard != shards_paths.size(); ++shard) {
+            sockaddr_un address;
+            std::memset(&address, 0, sizeof(address));
+            address.sun_family = AF_UNIX;
+            std::string socket_path = sockets_prefix + "." + std::to_string(shard);
+            if (socket_path.size() >= sizeof(address.sun_path))
+                return {};
+            std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size());
+            ::unlink(socket_path.c_str());
+
+            int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (listener < 0)
+                return {};
+            if (::bind(listener, (sockaddr*)&address, sizeof(address)) != 0 || ::listen(listener, 1) != 0) {
+                ::close(listener);
+                return {};
+            }
+
+            pid_t worker = ::fork();
+            if (worker < 0) {
+                ::close(listener);
+                return {};
+            }
+
+            // The child process serves the shard and never returns
+            if (worker == 0) {
+                for (int connection : router.connections_)
+                    ::close(connection);
+                int connection = ::accept(listener, nullptr, nullptr);
+                ::close(listener);
+                ::unlink(socket_path.c_str());
+                worker_t server;
+                bool served = false;
+                if (connection >= 0) {
+                    serialization_result_t viewed = server.view(shards_paths[shard].c_str(), threads);
+                    served = static_cast<bool>(viewed);
+                    viewed.error.release();
+                    std::uint8_t ready = served;
+                    served = server_write(connection, &ready, sizeof(ready)) && served;
+                }
+                if (served)
+                    server.serve(connection);
+                ::close(connection);
+                ::_exit(served ? 0 : 1);
+            }
+
+            ::close(listener);
+            int connection = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (connection < 0 || ::connect(connection, (sockaddr*)&address, sizeof(address)) != 0) {
+                if (connection >= 0)
+                    ::close(connection);
+                // The child would otherwise block in `accept` forever, hanging the `waitpid` in `shutdown`
+                ::kill(worker, SIGKILL);
+                ::waitpid(worker, nullptr, 0);
+                ::unlink(socket_path.c_str());
+                return {};
+            }
+            router.workers_.push_back(worker);
+            router.connections_.push_back(connection);
+        }
+
+        // The workers map their shards concurrently, and the failed ones exit,
+        // to be reaped by the `shutdown` of the discarded router
+        for (int connection : router.connections_) {
+            std::uint8_t ready = 0;
+            if (!server_read(connection, &ready, sizeof(ready)) || !ready)
+                return {};
+        }
+        return router;
+    }
+
+    /**
+     *  @brief  Asks all the workers to exit, and waits for them.
+     */
+    void shutdown() noexcept {
+        server_request_head_t request;
+        request.opcode = server_opcode_t::shutdown_k;
+        for (int connection : connections_) {
+            server_write(connection, &request, sizeof(request));
+            ::close(connection);
+        }
+        for (pid_t worker : workers_)
+            ::waitpid(worker, nullptr, 0);
+        connections_.clear();
+        workers_.clear();
+    }
+
+    /**
+     *  @brief  Counts the entries across all the shards.
+     *  @return The total count, or `std::size_t(-1)` if any worker didn't answer.
+     */
+    std::size_t size() noexcept {
+        server_request_head_t request;
+        request.opcode = server_opcode_t::size_k;
+        std::size_t result = 0;
+        for (int connection : connections_) {
+            server_response_head_t response;
+            if (!server_write(connection, &request, sizeof(request)) ||
+                !server_read(connection, &response, sizeof(response)))
+                return std::size_t(-1);
+            result += static_cast<std::size_t>(response.size);
+        }
+        return result;
+    }
+
+    /**
+     *  @brief  Scatters a batch of queries to all the workers, and merges their results.
+     *          The requests are sent to all the workers first, so that they search concurrently.
+     *
+     *  @param[in] queries Row-major matrix of `count x dimensions` query scalars.
+     *  @param[in] count The number of queries in the batch.
+     *  @param[in] dimensions The number of dimensions in every query.
+     *  @param[in] wanted The maximum number of results per query.
+     *  @param[out] keys Row-major matrix of `count x wanted` keys, sorted by distance within each row.
+     *  @param[out] distances Row-major matrix of `count x wanted` distances.
+     *  @param[out] counts The number of results found for every query.
+     *  @return The outcome, that references the message of the failed worker until the next `search`.
+     */
+    template <typename scalar_at>
+    search_result_t search(                          //
+        scalar_at const* queries, std::size_t count, //
+        std::size_t dimensions, std::size_t wanted,  //
+        key_t* keys, distance_t* distances,          //
+        std::size_t* counts) {
+
+        search_result_t result;
+        server_request_head_t request;
+        request.opcode = server_opcode_t::search_k;
+        request.scalar_kind = unum::usearch::scalar_kind<scalar_at>();
+        request.queries = count;
+        request.wanted = wanted;
+        request.dimensions = dimensions;
+        std::size_t bytes_per_vector = divide_round_up<CHAR_BIT>(dimensions * bits_per_scalar(request.scalar_kind));
+
+        // Scatter
+        for (int connection : connections_)
+            if (!server_write(connection, &request, sizeof(request)) ||
+                !server_write(connection, queries, count * bytes_per_vector))
+                return result.failed("Failed to send the queries to a worker");
+
+        // Gather, merging the sorted results of every shard into the output rows
+        std::fill_n(counts, count, 0);
+        shard_counts_.resize(count);
+        shard_keys_.resize(count * wanted);
+        shard_distances_.resize(count * wanted);
+        bool worker_failed = false;
+        for (int connection : connections_) {
+            server_response_head_t response;
+            if (!server_read(connection, &response, sizeof(response)))
+                return result.failed("Failed to receive the results from a worker");
+            if (response.status) {
+                // Drain the message, but keep gathering from other workers to keep all the streams in sync
+                worker_error_.resize(response.error_length);
+                if (!server_read(connection, &worker_error_[0], worker_error_.size()))
+                    return result.failed("Failed to receive the error from a worker");
+                worker_failed = true;
+                continue;
+            }
+            if (!server_read(connection, shard_counts_.data(), count * sizeof(std::uint64_t)) ||
+                !server_read(connection, shard_keys_.data(), count * wanted * sizeof(key_t)) ||
+                !server_read(connection, shard_distances_.data(), count * wanted * sizeof(distance_t)))
+                return result.failed("Failed to receive the results from a worker");
+
+            for (std::size_t query = 0; query != count; ++query)
+                counts[query] = merge_(                                                            //
+                    shard_keys_.data() + query * wanted, shard_distances_.data() + query * wanted, //
+                    static_cast<std::size_t>(shard_counts_[query]),                                //
+                    keys + query * wanted, distances + query * wanted, counts[query], wanted);
+        }
+        if (worker_failed)
+            return result.failed(worker_error_.c_str());
+
+        result.queries = count;
+        result.shards = connections_.size();
+        return result;
+    }
+
+  private:
+    /// @brief Inserts sorted candidates into a sorted row, keeping at most ::max_count best entries.
+    static std::size_t merge_(                                  //
+        key_t const* new_keys, distance_t const* new_distances, //
+        std::size_t new_count,                                  //
+        key_t* keys, distance_t* distances,                     //
+        std::size_t old_count, std::size_t max_count) noexcept {
+
+        std::size_t merged_count = old_count;
+        for (std::size_t i = 0; i != new_count; ++i) {
+            distance_t* merged_end = distances + merged_count;
+            std::size_t offset = std::upper_bound(distances, merged_end, new_distances[i]) - distances;
+            if (offset == max_count)
+                break;
+
+            std::size_t count_worse = merged_count - offset - (max_count == merged_count);
+            std::memmove(keys + offset + 1, keys + offset, count_worse * sizeof(key_t));
+            std::memmove(distances + offset + 1, distances + offset, count_worse * sizeof(distance_t));
+            keys[offset] = new_keys[i];
+            distances[offset] = new_distances[i];
+            merged_count += merged_count != max_count;
+        }
+        return merged_count;
+    }
+};
+
+using server_worker_t = server_worker_gt<>;
+using server_router_t = server_router_gt<>;
+
+} // namespace usearch
+} // namespace unum
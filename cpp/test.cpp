@@ -2,11 +2,15 @@
  * @brief A trivial test.
  */
 #include <algorithm>
+#include <numeric>
+#include <thread>
 #include <stdexcept>
 #include <unordered_map>
 
 #include <usearch/index.hpp>
 #include <usearch/index_dense.hpp>
+#include <usearch/index_ivf.hpp>
+#include <usearch/index_sharded.hpp>
 #include <usearch/index_plugins.hpp>
 
 using namespace unum::usearch;
@@ -17,6 +21,33 @@ void expect(bool must_be_true) {
         throw std::runtime_error("Failed!");
 }
 
+std::vector<float> make_random_vectors(std::size_t count, std::size_t dimensions) {
+    std::vector<float> scalars(count * dimensions);
+    std::generate(scalars.begin(), scalars.end(), [] { return float(std::rand()) / float(INT_MAX); });
+    return scalars;
+}
+
+template <typename key_at, typename slot_at> struct filled_index_gt {
+    index_dense_gt<key_at, slot_at> index;
+    std::vector<float> scalars;
+};
+
+/**
+ *  @brief  Builds an L2 index of random vectors, keyed by their position in `scalars`.
+ */
+template <typename key_at, typename slot_at>
+filled_index_gt<key_at, slot_at> make_filled_index(std::size_t dimensions, std::size_t count,
+                                                   scalar_kind_t scalar_kind = scalar_kind_t::f32_k,
+                                                   index_dense_config_t config = {}) {
+    using index_t = index_dense_gt<key_at, slot_at>;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind);
+    filled_index_gt<key_at, slot_at> filled{index_t::make(metric, config), make_random_vectors(count, dimensions)};
+    filled.index.reserve(count);
+    for (std::size_t task = 0; task != count; ++task)
+        filled.index.add(static_cast<key_at>(task), filled.scalars.data() + dimensions * task);
+    return filled;
+}
+
 template <bool punned_ak, typename index_at, typename scalar_at, typename... extra_args_at>
 void test_cosine(index_at& index, std::vector<std::vector<scalar_at>> const& vectors, extra_args_at&&... args) {
 
@@ -227,6 +258,675 @@ template <typename key_at, typename slot_at> void test_tanimoto(std::size_t dime
     });
 }
 
+template <typename key_at, typename slot_at> void test_join(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using slot_t = slot_at;
+
+    using index_punned_t = index_dense_gt<key_t, slot_t>;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_punned_t men = index_punned_t::make(metric);
+
+    executor_default_t executor;
+    std::vector<float> scalars(collection_size * dimensions);
+    std::generate(scalars.begin(), scalars.end(), [] { return float(std::rand()) / float(INT_MAX); });
+
+    men.reserve({collection_size, executor.size()});
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        men.add(static_cast<key_t>(task), scalars.data() + dimensions * task, thread);
+    });
+    index_punned_t women = men.copy().index;
+
+    // Every man must be engaged to at most one woman, and vice versa
+    key_t const missing_key = default_free_value<key_t>();
+    std::vector<key_t> man_to_woman(collection_size, missing_key);
+    std::vector<key_t> woman_to_man(collection_size, missing_key);
+    index_join_config_t config;
+    config.batch_size = 7;
+    join_result_t result = join(men, women, config, man_to_woman.data(), woman_to_man.data(), executor);
+    expect(bool(result));
+    expect(result.rounds > 0);
+    expect(result.proposals >= result.intersection_size);
+    expect(result.intersection_size > 0 && result.intersection_size <= collection_size);
+
+    // Every proposal and engagement is attributed to a round, and the first round has every man propose
+    std::size_t round_proposals = 0, round_engagements = 0;
+    for (join_round_t const& round : result.rounds_stats)
+        round_proposals += round.proposals, round_engagements += round.engagements;
+    expect(round_proposals == result.proposals && round_engagements == result.engagements);
+    expect(result.rounds_stats[0].proposals == collection_size && result.rounds_stats[0].elapsed_ns > 0);
+
+    std::size_t matched_count = 0;
+    for (std::size_t man = 0; man != collection_size; ++man) {
+        key_t woman = man_to_woman[man];
+        if (woman == missing_key)
+            continue;
+        expect(woman_to_man[static_cast<std::size_t>(woman)] == static_cast<key_t>(man));
+        matched_count++;
+    }
+    expect(matched_count == result.intersection_size);
+
+    // Export the k-NN graph, and make sure members don't list themselves
+    std::size_t const k = 5;
+    std::vector<key_t> members_keys(men.size());
+    std::vector<key_t> neighbors_keys(men.size() * k);
+    std::vector<float> neighbors_distances(men.size() * k);
+    auto graph = men.knn_graph(k, executor, neighbors_keys.data(), neighbors_distances.data(), members_keys.data());
+    expect(bool(graph));
+    expect(graph.members == men.size());
+    for (std::size_t row = 0; row != men.size(); ++row)
+        for (std::size_t column = 0; column != k; ++column) {
+            key_t neighbor_key = neighbors_keys[row * k + column];
+            expect(neighbor_key != members_keys[row]);
+            expect(neighbor_key != men.free_key() || collection_size <= k);
+            if (column)
+                expect(neighbors_distances[row * k + column - 1] <= neighbors_distances[row * k + column]);
+        }
+}
+
+template <typename key_at, typename slot_at> void test_kmeans(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using slot_t = slot_at;
+
+    using index_punned_t = index_dense_gt<key_t, slot_t>;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_punned_t index = index_punned_t::make(metric);
+
+    // Generate points around a few well separated centers
+    std::size_t const clusters = 4;
+    executor_default_t executor;
+    std::vector<float> scalars(collection_size * dimensions);
+    for (std::size_t i = 0; i != collection_size; ++i)
+        for (std::size_t j = 0; j != dimensions; ++j)
+            scalars[i * dimensions + j] = float(i % clusters) * 10.f + float(std::rand()) / float(INT_MAX);
+
+    index.reserve({collection_size, executor.size()});
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        index.add(static_cast<key_t>(task), scalars.data() + dimensions * task, thread);
+    });
+
+    for (std::size_t batch_size : {std::size_t(0), collection_size / 4}) {
+        index_dense_kmeans_config_t config;
+        config.clusters = clusters;
+        config.batch_size = batch_size;
+        std::vector<float> centroids(clusters * dimensions);
+        std::vector<key_t> members_keys(index.size());
+        std::vector<std::size_t> members_clusters(index.size());
+        auto result = index.kmeans(config, centroids.data(), members_keys.data(), members_clusters.data(), nullptr,
+                                   executor);
+        expect(bool(result));
+        expect(result.clusters == clusters);
+
+        // Members generated around the same center must end up in the same cluster
+        std::vector<std::size_t> center_to_cluster(clusters, clusters);
+        for (std::size_t row = 0; row != index.size(); ++row) {
+            std::size_t center = static_cast<std::size_t>(members_keys[row]) % clusters;
+            if (center_to_cluster[center] == clusters)
+                center_to_cluster[center] = members_clusters[row];
+            expect(center_to_cluster[center] == members_clusters[row]);
+        }
+    }
+}
+
+template <typename key_at> void test_ivf(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_punned_t = index_dense_gt<key_t, std::uint32_t>;
+    using index_ivf_t = index_ivf_gt<key_t>;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_punned_t source = index_punned_t::make(metric);
+
+    executor_default_t executor;
+    std::vector<float> scalars(collection_size * dimensions);
+    std::generate(scalars.begin(), scalars.end(), [] { return float(std::rand()) / float(INT_MAX); });
+    source.reserve({collection_size, executor.size()});
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        source.add(static_cast<key_t>(task), scalars.data() + dimensions * task, thread);
+    });
+
+    // Partition the existing index, and check that every vector finds itself
+    index_dense_kmeans_config_t kmeans_config;
+    kmeans_config.clusters = 16;
+    index_ivf_t index = index_ivf_t::make(metric, index_ivf_config_t(4));
+    expect(bool(index.train(source, kmeans_config, executor)));
+    expect(index.size() == collection_size);
+    expect(index.lists() == kmeans_config.clusters);
+
+    key_t matched_keys[10] = {0};
+    float matched_distances[10] = {0};
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        auto result = index.search(scalars.data() + dimensions * task, 10);
+        expect(bool(result));
+        expect(result.dump_to(matched_keys, matched_distances) == 10);
+        expect(matched_keys[0] == static_cast<key_t>(task));
+        expect(std::is_sorted(matched_distances, matched_distances + 10));
+    }
+
+    // Concurrent queries scan the same lists under shared locks
+    std::atomic<std::size_t> self_matches{0};
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        auto result = index.search(scalars.data() + dimensions * task, 1, thread);
+        if (result && result.size() && result[0].key == static_cast<key_t>(task))
+            self_matches++;
+    });
+    expect(self_matches == collection_size);
+
+    // More threads than thread IDs, searching without an explicit ID, wait for a free one
+    std::size_t const threads_count = std::thread::hardware_concurrency() * 2 + 1;
+    std::atomic<std::size_t> oversubscribed_matches{0};
+    std::vector<std::thread> threads;
+    for (std::size_t thread = 0; thread != threads_count; ++thread)
+        threads.emplace_back([&, thread] {
+            for (std::size_t task = thread; task < collection_size; task += threads_count) {
+                auto result = index.search(scalars.data() + dimensions * task, 1);
+                if (result && result.size() && result[0].key == static_cast<key_t>(task))
+                    oversubscribed_matches++;
+            }
+        });
+    for (std::thread& thread : threads)
+        thread.join();
+    expect(oversubscribed_matches == collection_size);
+
+    // Incremental additions and serialization
+    std::vector<float> extra(dimensions, 0.5f);
+    expect(bool(index.add(static_cast<key_t>(collection_size), extra.data())));
+    expect(index.size() == collection_size + 1);
+    expect(bool(index.save("tmp.usearch")));
+    index_ivf_t loaded;
+    expect(bool(loaded.load("tmp.usearch")));
+    expect(loaded.size() == index.size());
+    auto result = loaded.search(extra.data(), 1);
+    expect(result.size() == 1 && result[0].key == static_cast<key_t>(collection_size));
+    expect(loaded.memory_usage() > 0);
+}
+
+template <typename key_at, typename slot_at> void test_sharded(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_sharded_t = index_sharded_gt<key_t, slot_at>;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+    index_sharded_t index = index_sharded_t::make(metric, 4);
+    expect(index.shards() == 4);
+
+    executor_default_t executor;
+    std::vector<float> scalars(collection_size * dimensions);
+    std::generate(scalars.begin(), scalars.end(), [] { return float(std::rand()) / float(INT_MAX); });
+    expect(index.reserve({collection_size, executor.size()}));
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        index.add(static_cast<key_t>(task), scalars.data() + dimensions * task, thread);
+    });
+    expect(index.size() == collection_size);
+    for (std::size_t shard = 0; shard != index.shards(); ++shard)
+        expect(index.shard(shard).size() < collection_size);
+
+    // Every vector must find itself, no matter which shard it was routed to
+    key_t matched_keys[10] = {0};
+    float matched_distances[10] = {0};
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        auto result = index.search(scalars.data() + dimensions * task, 10, matched_keys, matched_distances, executor);
+        expect(bool(result));
+        expect(result.size() == 10);
+        expect(matched_keys[0] == static_cast<key_t>(task));
+        expect(std::is_sorted(matched_distances, matched_distances + 10));
+    }
+
+    // Shards are serialized independently
+    expect(bool(index.save("tmp.usearch", executor)));
+    index_sharded_t loaded = index_sharded_t::make(metric, 4);
+    expect(bool(loaded.load("tmp.usearch", executor)));
+    expect(loaded.size() == collection_size);
+    expect(loaded.contains(static_cast<key_t>(collection_size / 2)));
+    expect(bool(loaded.remove(static_cast<key_t>(collection_size / 2))));
+    expect(!loaded.contains(static_cast<key_t>(collection_size / 2)));
+}
+
+template <typename key_at, typename slot_at> void test_cache(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    index_dense_config_t config;
+    config.cache_capacity = 64;
+    auto filled = make_filled_index<key_t, slot_at>(dimensions, collection_size, scalar_kind_t::f32_k, config);
+    index_t& index = filled.index;
+    std::vector<float> const& scalars = filled.scalars;
+    expect(index.cache_stats().capacity == 64);
+
+    // Repeated queries must be answered from the cache with identical results
+    float const* query = scalars.data() + dimensions * 7;
+    key_t first_keys[10] = {0}, second_keys[10] = {0};
+    float first_distances[10] = {0}, second_distances[10] = {0};
+    std::size_t first_count = index.search(query, 10).dump_to(first_keys, first_distances);
+    expect(index.cache_stats().hits == 0);
+    std::size_t second_count = index.search(query, 10).dump_to(second_keys, second_distances);
+    expect(index.cache_stats().hits == 1);
+    expect(first_count == second_count);
+    expect(std::equal(first_keys, first_keys + first_count, second_keys));
+    expect(std::equal(first_distances, first_distances + first_count, second_distances));
+
+    // Different number of wanted results is a different query
+    expect(index.search(query, 5).size() == 5);
+    expect(index.cache_stats().hits == 1);
+
+    // Mutations must invalidate the cached results
+    expect(bool(index.remove(static_cast<key_t>(7))));
+    auto result = index.search(query, 10);
+    expect(index.cache_stats().hits == 1);
+    expect(result.size() == 10);
+    expect(result[0].member.key != static_cast<key_t>(7));
+    index.add(static_cast<key_t>(collection_size), query);
+    expect(index.search(query, 10)[0].member.key == static_cast<key_t>(collection_size));
+    expect(index.cache_stats().hits == 1);
+    expect(index.search(query, 10)[0].member.key == static_cast<key_t>(collection_size));
+    expect(index.cache_stats().hits == 2);
+
+    expect(index.change_cache_capacity(0));
+    expect(!index.cache_stats().capacity);
+    expect(index.search(query, 10).size() == 10);
+    expect(index.cache_stats().hits == 0);
+}
+
+void test_ring() {
+
+    // A full ring must report its size, rather than appearing empty
+    ring_gt<std::size_t> ring;
+    expect(ring.reserve(64));
+    for (std::size_t i = 0; i != ring.capacity(); ++i)
+        expect(ring.try_push(i));
+    expect(ring.size() == ring.capacity());
+    expect(!ring.try_push(ring.capacity()));
+
+    // Growing a full ring must preserve the order of its elements
+    std::size_t const old_capacity = ring.capacity();
+    expect(ring.reserve(old_capacity + 1));
+    expect(ring.size() == old_capacity);
+    for (std::size_t i = 0; i != old_capacity; ++i)
+        expect(ring[i] == i);
+
+    std::size_t popped = 0;
+    for (std::size_t i = 0; i != old_capacity; ++i)
+        expect(ring.try_pop(popped) && popped == i);
+    expect(ring.empty() && ring.size() == 0);
+}
+
+template <typename key_at, typename slot_at>
+void test_compact_keys(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    auto filled = make_filled_index<key_t, slot_at>(dimensions, collection_size);
+    index_t& index = filled.index;
+    std::vector<float> const& scalars = filled.scalars;
+
+    // Remove more entries than the free-list initially fits
+    std::size_t removed_count = 0;
+    for (std::size_t task = 1; task < collection_size; task += 2)
+        removed_count += index.remove(static_cast<key_t>(task)).completed;
+    expect(removed_count > 64);
+    expect(index.size() == collection_size - removed_count);
+
+    // Compaction moves the members to new slots, and the keys must follow them
+    index.compact();
+    expect(index.size() == collection_size - removed_count);
+    std::vector<float> reconstructed(dimensions);
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        key_t key = static_cast<key_t>(task);
+        if (task % 2) {
+            expect(!index.contains(key));
+            continue;
+        }
+        expect(index.contains(key));
+        expect(index.get(key, reconstructed.data()));
+        expect(std::equal(reconstructed.begin(), reconstructed.end(), scalars.data() + dimensions * task));
+    }
+
+    // Removals after compaction must hit the right members
+    expect(index.remove(static_cast<key_t>(0)).completed);
+    expect(!index.contains(static_cast<key_t>(0)));
+    expect(index.contains(static_cast<key_t>(2)));
+}
+
+template <typename key_at, typename slot_at>
+void test_entry_points(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    auto filled = make_filled_index<key_t, slot_at>(dimensions, collection_size);
+    index_t& index = filled.index;
+    std::vector<float> const& scalars = filled.scalars;
+
+    expect(index.refresh_entry_points(16));
+    expect(index.entry_points() && index.entry_points() <= 16);
+
+    // Every vector must still find itself, starting from the closest entry point
+    for (std::size_t task = 0; task != collection_size; ++task) {
+        auto result = index.search(scalars.data() + dimensions * task, 10);
+        expect(result.size() == 10);
+        expect(result[0].member.key == static_cast<key_t>(task));
+    }
+
+    // Entry points must follow the members, when the slots are reordered
+    index.compact();
+    for (std::size_t task = 0; task != collection_size; task += 10)
+        expect(index.search(scalars.data() + dimensions * task, 10)[0].member.key == static_cast<key_t>(task));
+
+    expect(index.refresh_entry_points(0));
+    expect(!index.entry_points());
+}
+
+template <typename key_at, typename slot_at>
+void test_build_stats(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    auto filled = make_filled_index<key_t, slot_at>(dimensions, collection_size);
+    index_t& index = filled.index;
+
+    // Construction phases are only timed, if compiled with `USEARCH_USE_PROFILING`
+    index_build_stats_t build_stats = index.build_stats();
+#if USEARCH_USE_PROFILING
+    expect(build_stats.insertions == collection_size - 1);
+    expect(build_stats.search_cycles && build_stats.refine_cycles);
+    expect(build_stats.total_cycles >= build_stats.descent_cycles + build_stats.search_cycles +
+                                           build_stats.refine_cycles + build_stats.reconnect_cycles);
+#else
+    expect(build_stats.insertions == 0 && build_stats.total_cycles == 0);
+#endif
+
+    index.reset_build_stats();
+    expect(index.build_stats().insertions == 0);
+}
+
+template <typename key_at, typename slot_at>
+void test_search_stats(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    auto filled = make_filled_index<key_t, slot_at>(dimensions, collection_size, scalar_kind_t::f16_k);
+    index_t& index = filled.index;
+    std::vector<float> const& scalars = filled.scalars;
+
+    // Nothing is counted until enabled
+    index.search(scalars.data(), 10);
+    expect(!index.search_stats_enabled());
+    expect(index.search_stats().searches == 0);
+
+    // Removed members are still traversed, but rejected by the predicate
+    for (std::size_t task = 0; task < collection_size; task += 2)
+        index.remove(static_cast<key_t>(task));
+
+    index.enable_search_stats();
+    std::size_t computed_distances = 0, rejected_members = 0;
+    for (std::size_t task = 1; task < collection_size; task += 2) {
+        auto result = index.search(scalars.data() + dimensions * task, 10);
+        expect(result.size() == 10);
+        computed_distances += result.computed_distances;
+        rejected_members += result.rejected_members;
+    }
+
+    index_search_stats_t stats = index.search_stats();
+    expect(stats.searches == collection_size / 2);
+    expect(stats.computed_distances == computed_distances);
+    expect(stats.rejected_members == rejected_members && rejected_members);
+    expect(stats.visited_members && stats.visits && stats.top_candidates >= stats.searches * 10);
+    expect(stats.cast_nanoseconds);
+
+    // Growing the number of threads moves the counters into the new contexts
+    expect(index.reserve(index_limits_t(index.capacity(), index.limits().threads() + 1)));
+    expect(index.search_stats().searches == stats.searches);
+    expect(index.search_stats().computed_distances == stats.computed_distances);
+
+    index.reset_search_stats();
+    expect(index.search_stats().searches == 0);
+}
+
+template <typename key_at, typename slot_at> void test_health(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    auto filled = make_filled_index<key_t, slot_at>(dimensions, collection_size);
+    index_t& index = filled.index;
+    std::vector<float> const& scalars = filled.scalars;
+
+    // A freshly built graph is fully connected
+    auto health = index.health(0, executor_default_t{});
+    expect(bool(health));
+    expect(health.nodes == collection_size && health.reachable_nodes == collection_size);
+    expect(!health.banned_nodes && !health.banned_edges && !health.orphan_nodes);
+    expect(health.mean_neighbor_distance > 0);
+    expect(std::accumulate(health.out_degrees.begin(), health.out_degrees.end(), std::size_t(0)) == health.nodes);
+    expect(std::accumulate(health.in_degrees.begin(), health.in_degrees.end(), std::size_t(0)) == health.nodes);
+    std::size_t edges = 0;
+    for (std::size_t degree = 0; degree <= health.max_degree; ++degree)
+        edges += degree * health.out_degrees[degree];
+    expect(edges == health.edges);
+
+    // Executors wider than the reserved thread contexts are refused
+    auto too_wide = index.health(0, executor_default_t{index.limits().threads() + 1});
+    expect(!too_wide);
+    too_wide.error.release();
+
+    // Isolating most of the members leaves the remaining ones disconnected
+    for (std::size_t task = 0; task != collection_size; ++task)
+        if (task % 8)
+            index.remove(static_cast<key_t>(task));
+    health = index.health(0);
+    expect(health.banned_nodes == index.size() * 7 && health.banned_edges);
+    index.isolate();
+    health = index.health(0);
+    expect(!health.banned_edges && health.unreachable_nodes());
+
+    std::size_t unreachable_nodes = health.unreachable_nodes();
+    auto repaired = index.repair();
+    expect(bool(repaired) && repaired.reconnected == unreachable_nodes);
+    health = index.health(0);
+    expect(health.reachable_nodes == index.size() && !health.unreachable_nodes());
+    for (std::size_t task = 0; task < collection_size; task += 8)
+        expect(index.search(scalars.data() + dimensions * task, 1)[0].member.key == static_cast<key_t>(task));
+}
+
+template <typename key_at, typename slot_at>
+void test_memory_stats(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    auto filled = make_filled_index<key_t, slot_at>(dimensions, collection_size);
+    index_t& index = filled.index;
+
+    // An empty index with the same capacity is the baseline
+    index_t reserved = index.fork().index;
+    reserved.reserve(collection_size);
+    index_dense_memory_stats_t empty = reserved.memory_stats();
+    expect(!empty.graph && !empty.vectors && empty.slots && empty.contexts);
+
+    // Vectors are only padded to 8 bytes, and every arena keeps a small header
+    index_dense_memory_stats_t stats = index.memory_stats();
+    std::size_t const vectors_bytes = collection_size * index.bytes_per_vector();
+    expect(stats.graph == index.stats().allocated_bytes);
+    expect(stats.vectors >= vectors_bytes && stats.vectors < vectors_bytes + 1024);
+    expect(stats.arenas_reserved);
+    expect(stats.total() == index.memory_usage());
+
+    // Every key is a separate hash-table node, holding the slot and chained from its bucket
+    std::size_t const key_bytes = sizeof(key_t) + sizeof(slot_at) + sizeof(void*);
+    expect(empty.keys && stats.keys >= empty.keys + collection_size * key_bytes);
+
+    // Viewed indexes don't own the nodes and vectors
+    index.save("tmp.usearch");
+    index_t view = index.fork().index;
+    expect(bool(view.view("tmp.usearch")));
+    index_dense_memory_stats_t view_stats = view.memory_stats();
+    expect(!view_stats.graph && !view_stats.vectors && !view_stats.arenas_wasted);
+    expect(view_stats.total() < stats.total());
+
+    // The counter moves along with the hash-table, and falls back as the nodes are freed
+    index_t moved = std::move(index);
+    expect(moved.memory_stats().keys == stats.keys);
+    moved.clear();
+    expect(moved.memory_stats().keys == empty.keys);
+}
+
+template <typename key_at, typename slot_at>
+void test_vectors_matrix(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using slot_t = slot_at;
+    using index_t = index_dense_gt<key_t, slot_t>;
+    auto filled = make_filled_index<key_t, slot_at>(dimensions, collection_size);
+    index_t& index = filled.index;
+    std::vector<float> const& scalars = filled.scalars;
+    expect(!index.vectors_matrix().size());
+    index.save("tmp.usearch");
+
+    // Both loaded and viewed indexes keep the vectors in a single matrix, with slots for rows
+    index_t loaded = index.fork().index;
+    index_t viewed = index.fork().index;
+    expect(bool(loaded.load("tmp.usearch")));
+    expect(bool(viewed.view("tmp.usearch")));
+    for (index_t const* other : {&loaded, &viewed}) {
+        span_gt<byte_t const> matrix = other->vectors_matrix();
+        expect(matrix.size() == collection_size * index.bytes_per_vector());
+        for (std::size_t task = 0; task != collection_size; ++task) {
+            slot_t slot{};
+            expect(other->slot_of(static_cast<key_t>(task), slot));
+            byte_t const* row = matrix.data() + static_cast<std::size_t>(slot) * index.bytes_per_vector();
+            expect(std::memcmp(row, scalars.data() + dimensions * task, index.bytes_per_vector()) == 0);
+        }
+    }
+
+    slot_t missing{};
+    expect(!loaded.slot_of(static_cast<key_t>(collection_size), missing));
+    loaded.clear();
+    expect(!loaded.vectors_matrix().size());
+}
+
+template <typename key_at, typename slot_at>
+void test_online_growth(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    index_t index = make_filled_index<key_t, slot_at>(dimensions, 0).index;
+    std::vector<float> const scalars = make_random_vectors(collection_size, dimensions);
+
+    // Two threads insert, one searches, and the main one keeps growing the capacity under them
+    std::size_t const threads_count = 3;
+    std::size_t const adders_count = 2;
+    index.reserve(index_limits_t(64, threads_count));
+    std::atomic<std::size_t> adders_done{0};
+    std::vector<std::thread> threads;
+    for (std::size_t thread = 0; thread != adders_count; ++thread)
+        threads.emplace_back([&, thread] {
+            for (std::size_t task = thread; task < collection_size; task += adders_count) {
+                while (index.size() + adders_count >= index.capacity())
+                    std::this_thread::yield();
+                expect(bool(index.add(static_cast<key_t>(task), scalars.data() + dimensions * task, thread)));
+            }
+            adders_done++;
+        });
+    threads.emplace_back([&] {
+        while (adders_done != adders_count)
+            if (index.size())
+                expect(bool(index.search(scalars.data(), 10, adders_count)));
+    });
+
+    while (adders_done != adders_count)
+        if (index.capacity() - index.size() < 32)
+            expect(index.reserve(index_limits_t(index.capacity() * 2, threads_count)));
+        else
+            std::this_thread::yield();
+    for (std::thread& thread : threads)
+        thread.join();
+
+    expect(index.size() == collection_size);
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(index.contains(static_cast<key_t>(task)));
+    expect(index.search(scalars.data(), 1)[0].member.key == 0);
+}
+
+template <typename key_at, typename slot_at>
+void test_oversubscribed_threads(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    index_t index = make_filled_index<key_t, slot_at>(dimensions, 0).index;
+    std::vector<float> const scalars = make_random_vectors(collection_size, dimensions);
+
+    // More threads than hardware thread IDs, like a thread pool of a runtime, must wait for a free ID
+    std::size_t const threads_count = std::thread::hardware_concurrency() * 2 + 1;
+    expect(index.reserve(collection_size));
+    std::vector<std::thread> threads;
+    for (std::size_t thread = 0; thread != threads_count; ++thread)
+        threads.emplace_back([&, thread] {
+            for (std::size_t task = thread; task < collection_size; task += threads_count) {
+                expect(bool(index.add(static_cast<key_t>(task), scalars.data() + dimensions * task)));
+                expect(bool(index.search(scalars.data() + dimensions * task, 10)));
+            }
+        });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    expect(index.size() == collection_size);
+    for (std::size_t task = 0; task != collection_size; ++task)
+        expect(index.contains(static_cast<key_t>(task)));
+
+    // Batches lease disjoint sets of IDs for their pools, and can't ask for more than the hardware has
+    std::size_t const batch_threads = (std::max)(std::thread::hardware_concurrency() / 2, 1u);
+    std::vector<std::size_t> batch_ids(std::thread::hardware_concurrency() + 1);
+    expect(!index.lease_threads(batch_ids.data(), batch_ids.size()));
+    std::vector<std::thread> batches;
+    for (std::size_t batch = 0; batch != 4; ++batch)
+        batches.emplace_back([&] {
+            std::vector<std::size_t> ids(batch_threads);
+            expect(index.lease_threads(ids.data(), ids.size()));
+            executor_default_t executor(batch_threads);
+            executor.dynamic(collection_size, [&](std::size_t thread, std::size_t task) {
+                expect(bool(index.search(scalars.data() + dimensions * task, 10, ids[thread])));
+                return true;
+            });
+            index.release_threads(ids.data(), ids.size());
+        });
+    for (std::thread& batch : batches)
+        batch.join();
+    expect(index.lease_threads(batch_ids.data(), std::thread::hardware_concurrency()));
+    index.release_threads(batch_ids.data(), std::thread::hardware_concurrency());
+}
+
+template <typename key_at, typename slot_at> void test_tune(std::size_t collection_size, std::size_t dimensions) {
+
+    using key_t = key_at;
+    using index_t = index_dense_gt<key_t, slot_at>;
+    auto filled = make_filled_index<key_t, slot_at>(dimensions, collection_size);
+    index_t& index = filled.index;
+    std::vector<float> const& scalars = filled.scalars;
+
+    // Query with perturbed copies of the first members
+    std::size_t const queries_count = collection_size / 10;
+    std::vector<float> queries(scalars.begin(), scalars.begin() + queries_count * dimensions);
+    for (float& scalar : queries)
+        scalar += float(std::rand()) / float(INT_MAX) * 0.1f;
+
+    index_dense_tune_config_t config;
+    config.target_recall = 0.9;
+    executor_default_t executor;
+    auto result = index.tune(queries.data(), queries_count, config, nullptr, executor);
+    expect(bool(result));
+    expect(result.recall >= config.target_recall);
+    expect(index.config().expansion_search == result.expansion);
+    expect(!result.pareto.empty());
+    for (std::size_t i = 1; i != result.pareto.size(); ++i) {
+        expect(result.pareto[i - 1].recall <= result.pareto[i].recall);
+        expect(result.pareto[i - 1].queries_per_second > result.pareto[i].queries_per_second);
+    }
+
+    // Unreachable targets settle for the most accurate explored option
+    config.target_recall = 1.1;
+    config.max_expansion = 64;
+    result = index.tune(queries.data(), queries_count, config, nullptr, executor);
+    expect(bool(result));
+    expect(result.expansion <= 64);
+    expect(index.config().expansion_search == result.expansion);
+}
+
 template <typename index_at> void test_sets(index_at&& index) {
 
     using index_t = typename std::remove_reference<index_at>::type;
@@ -277,5 +977,55 @@ int main(int, char**) {
         for (std::size_t dimensions : {97, 256})
             test_tanimoto<std::int64_t, std::uint32_t>(dimensions, connectivity);
 
+    for (std::size_t collection_size : {10, 500}) {
+        std::printf("Joining %zu vectors with l2sq: <std::int64_t, std::uint32_t> \n", collection_size);
+        test_join<std::int64_t, std::uint32_t>(collection_size, 97);
+    }
+
+    std::printf("Clustering with k-means: <std::int64_t, std::uint32_t> \n");
+    test_kmeans<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Indexing with inverted lists: <std::int64_t> \n");
+    test_ivf<std::int64_t>(1000, 16);
+
+    std::printf("Indexing with shards: <std::int64_t, std::uint32_t> \n");
+    test_sharded<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Caching search results: <std::int64_t, std::uint32_t> \n");
+    test_cache<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Tracking the size of ring buffers \n");
+    test_ring();
+
+    std::printf("Remapping the keys after compaction: <std::int64_t, std::uint32_t> \n");
+    test_compact_keys<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Searching from multiple entry points: <std::int64_t, std::uint32_t> \n");
+    test_entry_points<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Timing the construction phases: <std::int64_t, std::uint32_t> \n");
+    test_build_stats<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Counting the search work: <std::int64_t, std::uint32_t> \n");
+    test_search_stats<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Diagnosing and repairing the graph: <std::int64_t, std::uint32_t> \n");
+    test_health<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Accounting the memory usage: <std::int64_t, std::uint32_t> \n");
+    test_memory_stats<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Exposing the stored vectors as a matrix: <std::int64_t, std::uint32_t> \n");
+    test_vectors_matrix<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Growing the capacity under concurrent load: <std::int64_t, std::uint32_t> \n");
+    test_online_growth<std::int64_t, std::uint32_t>(20000, 16);
+
+    std::printf("Sharing thread IDs across more threads: <std::int64_t, std::uint32_t> \n");
+    test_oversubscribed_threads<std::int64_t, std::uint32_t>(1000, 16);
+
+    std::printf("Tuning the search expansion: <std::int64_t, std::uint32_t> \n");
+    test_tune<std::int64_t, std::uint32_t>(1000, 16);
+
     return 0;
 }
\ No newline at end of file
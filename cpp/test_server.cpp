@@ -0,0 +1,93 @@
+/**
+ * @brief A test harness for the multi-process sharded server, running on localhost.
+ */
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <usearch/index_sharded.hpp>
+
+#include "server.hpp"
+
+using namespace unum::usearch;
+using namespace unum;
+
+void expect(bool must_be_true) {
+    if (!must_be_true)
+        throw std::runtime_error("Failed!");
+}
+
+template <typename key_at> void test_server(std::size_t collection_size, std::size_t dimensions, std::size_t shards) {
+
+    using key_t = key_at;
+    using index_sharded_t = index_sharded_gt<key_t, std::uint32_t>;
+    using server_router_t = server_router_gt<key_t, std::uint32_t>;
+    metric_punned_t metric(dimensions, metric_kind_t::l2sq_k, scalar_kind_t::f32_k);
+
+    // Build and persist the shards in-process
+    index_sharded_t index = index_sharded_t::make(metric, shards);
+    executor_default_t executor;
+    std::vector<float> scalars(collection_size * dimensions);
+    std::generate(scalars.begin(), scalars.end(), [] { return float(std::rand()) / float(INT_MAX); });
+    expect(index.reserve({collection_size, executor.size()}));
+    executor.fixed(collection_size, [&](std::size_t thread, std::size_t task) {
+        index.add(static_cast<key_t>(task), scalars.data() + dimensions * task, thread);
+    });
+    expect(bool(index.save("tmp.usearch", executor)));
+
+    std::vector<std::string> shards_paths;
+    for (std::size_t shard = 0; shard != shards; ++shard)
+        shards_paths.push_back(index_sharded_t::shard_path("tmp.usearch", shard));
+
+    // Serve every shard from a separate process
+    server_router_t router = server_router_t::spawn(shards_paths, "tmp.usearch.sock", 2);
+    expect(bool(router));
+    expect(router.shards() == shards);
+    expect(router.size() == collection_size);
+
+    // Scatter the whole collection as a few batches, and check that every vector finds itself
+    std::size_t const wanted = 10, batch_size = 64;
+    std::vector<key_t> keys(batch_size * wanted);
+    std::vector<distance_punned_t> distances(batch_size * wanted);
+    std::vector<std::size_t> counts(batch_size);
+    for (std::size_t first = 0; first < collection_size; first += batch_size) {
+        std::size_t count = (std::min)(batch_size, collection_size - first);
+        auto result = router.search(scalars.data() + first * dimensions, count, dimensions, wanted, keys.data(),
+                                    distances.data(), counts.data());
+        expect(bool(result));
+        expect(result.queries == count);
+        for (std::size_t query = 0; query != count; ++query) {
+            expect(counts[query] == wanted);
+            expect(keys[query * wanted] == static_cast<key_t>(first + query));
+            expect(std::is_sorted(distances.data() + query * wanted, distances.data() + (query + 1) * wanted));
+        }
+    }
+
+    // Mismatching dimensions are reported, without breaking the connections
+    auto invalid = router.search(scalars.data(), 1, dimensions / 2, wanted, keys.data(), distances.data(),
+                                 counts.data());
+    expect(!invalid);
+    expect(std::strcmp(invalid.error.release(), "Dimensions of queries and the shard don't match") == 0);
+    expect(router.size() == collection_size);
+    router.shutdown();
+    expect(!router);
+
+    // Missing shard files are reported, instead of being served as empty indexes
+    server_worker_gt<key_t, std::uint32_t> worker;
+    auto missing = worker.view("tmp.usearch.missing");
+    expect(!missing);
+    missing.error.release();
+
+    // A single shard, that fails to map, fails the whole router, reaping the healthy workers
+    shards_paths.push_back("tmp.usearch.missing");
+    server_router_t partial = server_router_t::spawn(shards_paths, "tmp.usearch.sock", 2);
+    expect(!partial);
+}
+
+int main(int, char**) {
+
+    std::printf("Serving %zu shards: <std::int64_t, std::uint32_t> \n", std::size_t(3));
+    test_server<std::int64_t>(1000, 16, 3);
+
+    return 0;
+}
@@ -253,6 +253,27 @@ func (index *Index) Add(key Key, vec []float32) error {
 	return nil
 }
 
+// Adds a batch of vectors, packed into a row-major matrix, one row per key.
+// The work is split between native threads, or all available cores if zero.
+func (index *Index) AddMany(keys []Key, vectors []float32, threads uint) error {
+	if index.opaque_handle == nil {
+		panic("Index is uninitialized")
+	}
+	if uint(len(vectors)) != uint(len(keys))*index.config.Dimensions {
+		return errors.New("Number of keys and vectors doesn't match!")
+	}
+	if len(keys) == 0 {
+		return nil
+	}
+
+	var errorMessage *C.char
+	C.usearch_add_many((C.usearch_index_t)(unsafe.Pointer(index.opaque_handle)), (C.size_t)(len(keys)), (*C.usearch_key_t)(&keys[0]), unsafe.Pointer(&vectors[0]), 0, C.usearch_scalar_f32_k, (C.size_t)(threads), (*C.usearch_error_t)(&errorMessage))
+	if errorMessage != nil {
+		return errors.New(C.GoString(errorMessage))
+	}
+	return nil
+}
+
 // Removes the vector associated with the given key from the index.
 func (index *Index) Remove(key Key) error {
 	if index.opaque_handle == nil {
@@ -288,11 +309,11 @@ func (index *Index) Get(key Key) (vector []float32, err error) {
 
 	vector = make([]float32, index.config.Dimensions)
 	var errorMessage *C.char
-	found := bool(C.usearch_get((C.usearch_index_t)(unsafe.Pointer(index.opaque_handle)), (C.usearch_key_t)(key), unsafe.Pointer(&vector[0]), C.usearch_scalar_f32_k, (*C.usearch_error_t)(&errorMessage)))
+	found := uint(C.usearch_get((C.usearch_index_t)(unsafe.Pointer(index.opaque_handle)), (C.usearch_key_t)(key), (C.size_t)(1), unsafe.Pointer(&vector[0]), C.usearch_scalar_f32_k, (*C.usearch_error_t)(&errorMessage)))
 	if errorMessage != nil {
 		return nil, errors.New(C.GoString(errorMessage))
 	}
-	if !found {
+	if found == 0 {
 		return nil, nil
 	}
 	return vector, nil
@@ -320,6 +341,38 @@ func (index *Index) Search(query []float32, limit uint) (keys []Key, distances [
 	return keys, distances, nil
 }
 
+// Performs k-Approximate Nearest Neighbors Search for a batch of queries, packed into a row-major matrix.
+// The work is split between native threads, or all available cores if zero.
+// Returns row-major matrices with `limit` columns, and the number of matches found for every query.
+func (index *Index) SearchMany(queries []float32, limit uint, threads uint) (keys []Key, distances []float32, counts []uint, err error) {
+	if index.opaque_handle == nil {
+		panic("Index is uninitialized")
+	}
+	if index.config.Dimensions == 0 || uint(len(queries))%index.config.Dimensions != 0 {
+		return nil, nil, nil, errors.New("Number of dimensions doesn't match!")
+	}
+
+	queriesCount := uint(len(queries)) / index.config.Dimensions
+	if queriesCount == 0 || limit == 0 {
+		return nil, nil, make([]uint, queriesCount), nil
+	}
+
+	keys = make([]Key, queriesCount*limit)
+	distances = make([]float32, queriesCount*limit)
+	foundCounts := make([]C.size_t, queriesCount)
+	var errorMessage *C.char
+	C.usearch_search_many((C.usearch_index_t)(unsafe.Pointer(index.opaque_handle)), (C.size_t)(queriesCount), unsafe.Pointer(&queries[0]), 0, C.usearch_scalar_f32_k, (C.size_t)(limit), (C.size_t)(threads), (*C.usearch_key_t)(&keys[0]), (*C.usearch_distance_t)(&distances[0]), &foundCounts[0], (*C.usearch_error_t)(&errorMessage))
+	if errorMessage != nil {
+		return nil, nil, nil, errors.New(C.GoString(errorMessage))
+	}
+
+	counts = make([]uint, queriesCount)
+	for i, count := range foundCounts {
+		counts[i] = uint(count)
+	}
+	return keys, distances, counts, nil
+}
+
 // Saves the index to a file.
 func (index *Index) Save(path string) error {
 	if index.opaque_handle == nil {
@@ -102,4 +102,58 @@ func TestUSearch(t *testing.T) {
 			t.Fatalf("Expected result 42 with distance 0, got key %d with distance %f", keys[0], distances[0])
 		}
 	})
+
+	t.Run("Test Batch Insertion and Search", func(t *testing.T) {
+		dim := uint(128)
+		conf := DefaultConfig(dim)
+		ind, err := NewIndex(conf)
+		if err != nil {
+			t.Fatalf("Failed to construct the index: %s", err)
+		}
+		defer ind.Destroy()
+
+		count := uint(100)
+		keys := make([]Key, count)
+		vecs := make([]float32, count*dim)
+		for i := uint(0); i < count; i++ {
+			keys[i] = Key(i)
+			vecs[i*dim] = float32(i)
+			vecs[i*dim+1] = 1.0
+		}
+
+		err = ind.AddMany(keys, vecs, 4)
+		if err != nil {
+			t.Fatalf("Failed to insert a batch: %s", err)
+		}
+
+		found_len, err := ind.Len()
+		if err != nil {
+			t.Fatalf("Failed to retrieve size after insertion: %s", err)
+		}
+		if found_len != count {
+			t.Fatalf("Expected size to be %d, got %d", count, found_len)
+		}
+
+		vector, err := ind.Get(keys[3])
+		if err != nil {
+			t.Fatalf("Failed to retrieve a vector: %s", err)
+		}
+		if vector == nil || vector[0] != vecs[3*dim] || vector[1] != vecs[3*dim+1] {
+			t.Fatalf("Expected the stored vector to be exported unchanged")
+		}
+
+		limit := uint(10)
+		found_keys, _, found_counts, err := ind.SearchMany(vecs, limit, 4)
+		if err != nil {
+			t.Fatalf("Failed to search a batch: %s", err)
+		}
+		for i := uint(0); i < count; i++ {
+			if found_counts[i] != limit {
+				t.Fatalf("Expected %d results for query %d, got %d", limit, i, found_counts[i])
+			}
+		}
+		if found_keys[0] != keys[0] {
+			t.Fatalf("Expected the first query to find itself, got key %d", found_keys[0])
+		}
+	})
 }
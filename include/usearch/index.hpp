@@ -56,6 +56,16 @@
 #define USEARCH_USE_OPENMP 0
 #endif
 
+// Timing the phases of index construction, disabled by default
+#if !defined(USEARCH_USE_PROFILING)
+#define USEARCH_USE_PROFILING 0
+#endif
+
+// Static tracepoints for `perf`, `bpftrace` and SystemTap, disabled by default
+#if !defined(USEARCH_USE_USDT)
+#define USEARCH_USE_USDT 0
+#endif
+
 // OS-specific includes
 #if defined(USEARCH_DEFINED_WINDOWS)
 #define _USE_MATH_DEFINES
@@ -72,10 +82,15 @@
 #include <unistd.h>   // `open`, `close`
 #endif
 
+#if USEARCH_USE_USDT && defined(USEARCH_DEFINED_LINUX)
+#include <sys/sdt.h> // `STAP_PROBEV`, from SystemTap headers
+#endif
+
 // STL includes
 #include <algorithm> // `std::sort_heap`
 #include <atomic>    // `std::atomic`
 #include <bitset>    // `std::bitset`
+#include <chrono>    // `std::chrono::steady_clock`
 #include <climits>   // `CHAR_BIT`
 #include <cmath>     // `std::sqrt`
 #include <cstring>   // `std::memset`
@@ -120,6 +135,20 @@
 #define usearch_noexcept_m
 #endif
 
+// Profiling
+#if USEARCH_USE_PROFILING
+#define usearch_profile_m(name, cycles) profiled_scope_t name(cycles)
+#else
+#define usearch_profile_m(name, cycles)
+#endif
+
+// Tracing, where every probe is a single `nop` instruction, until a tracer attaches to it
+#if USEARCH_USE_USDT && defined(USEARCH_DEFINED_LINUX)
+#define usearch_trace_m(probe, ...) STAP_PROBEV(usearch, probe, __VA_ARGS__)
+#else
+#define usearch_trace_m(probe, ...)
+#endif
+
 namespace unum {
 namespace usearch {
 
@@ -147,6 +176,21 @@ inline std::size_t ceil2(std::size_t v) noexcept {
     return v;
 }
 
+/// @brief  Position of the most significant set bit of a non-zero integer.
+inline std::size_t floor_log2(std::size_t v) noexcept {
+#if defined(USEARCH_DEFINED_WINDOWS) && defined(USEARCH_64BIT_ENV)
+    unsigned long position;
+    _BitScanReverse64(&position, v);
+    return position;
+#elif defined(USEARCH_DEFINED_WINDOWS)
+    unsigned long position;
+    _BitScanReverse(&position, static_cast<unsigned long>(v));
+    return position;
+#else
+    return sizeof(unsigned long long) * CHAR_BIT - 1 - static_cast<std::size_t>(__builtin_clzll(v));
+#endif
+}
+
 /// @brief  Simply dereferencing misaligned pointers can be dangerous.
 template <typename at> void misaligned_store(void* ptr, at v) noexcept {
     static_assert(!std::is_reference<at>::value, "Can't store a reference");
@@ -410,6 +454,7 @@ template <typename allocator_at = std::allocator<byte_t>> class bitset_gt {
 
     explicit operator bool() const noexcept { return slots_; }
     void clear() noexcept { std::memset(slots_, 0, count_ * sizeof(compressed_slot_t)); }
+    std::size_t memory_usage() const noexcept { return count_ * sizeof(compressed_slot_t); }
 
     void reset() noexcept {
         if (slots_)
@@ -490,6 +535,159 @@ template <typename allocator_at = std::allocator<byte_t>> class bitset_gt {
 
 using bitset_t = bitset_gt<>;
 
+/**
+ *  @brief  Similar to `buffer_gt`, but split into segments, addressed through a directory.
+ *          Growing it never moves the existing entries, so other threads may keep reading and writing
+ *          them while `reserve` runs. Every next segment is twice as large as the previous one, so a
+ *          directory of a few dozen pointers, sized for @p capacity_bits_ak bits of addressable entries,
+ *          is embedded into the object and never replaced. Concurrent `reserve` calls must be serialized.
+ */
+template <typename scalar_at, typename allocator_at, std::size_t capacity_bits_ak = sizeof(std::size_t) * CHAR_BIT>
+class segmented_buffer_gt {
+    static_assert(std::is_trivially_copyable<scalar_at>::value, "Segments are zero-initialized and never move");
+    static_assert(std::is_trivially_destructible<scalar_at>::value, "Segments are zero-initialized and never move");
+
+    using segment_allocator_t = allocator_at;
+
+    static constexpr std::size_t first_segment_bits() { return 12; }
+    /// @brief  Leaves two spare bits, so that the offsets past the last segment don't overflow.
+    static constexpr std::size_t capacity_bits() {
+        return capacity_bits_ak < sizeof(std::size_t) * CHAR_BIT - 2 ? capacity_bits_ak
+                                                                      : sizeof(std::size_t) * CHAR_BIT - 2;
+    }
+    static constexpr std::size_t directory_size() {
+        return capacity_bits() > first_segment_bits() ? capacity_bits() - first_segment_bits() + 1 : 1;
+    }
+    static constexpr std::size_t segment_size(std::size_t segment) {
+        return std::size_t(1) << (first_segment_bits() + segment);
+    }
+    /// @brief  Number of entries in all the segments preceding the given one.
+    static constexpr std::size_t segment_offset(std::size_t segment) {
+        return segment_size(segment) - segment_size(0);
+    }
+
+    /// @brief  Addresses of all the segments, published with release stores, and never replaced until `reset`.
+    std::atomic<scalar_at*> directory_[directory_size()]{};
+    /// @brief  Number of segments allocated so far.
+    std::atomic<std::size_t> segments_{};
+
+  public:
+    segmented_buffer_gt() noexcept {}
+    ~segmented_buffer_gt() noexcept { reset(); }
+
+    segmented_buffer_gt(segmented_buffer_gt const&) = delete;
+    segmented_buffer_gt& operator=(segmented_buffer_gt const&) = delete;
+
+    segmented_buffer_gt(segmented_buffer_gt&& other) noexcept { swap(other); }
+    segmented_buffer_gt& operator=(segmented_buffer_gt&& other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    void swap(segmented_buffer_gt& other) noexcept {
+        for (std::size_t i = 0; i != directory_size(); ++i)
+            directory_[i] = other.directory_[i].exchange(directory_[i].load());
+        segments_ = other.segments_.exchange(segments_.load());
+    }
+
+    std::size_t size() const noexcept { return segment_offset(segments_.load()); }
+    explicit operator bool() const noexcept { return segments_.load(); }
+
+    inline scalar_at& operator[](std::size_t i) noexcept {
+        std::size_t segment = floor_log2((i >> first_segment_bits()) + 1);
+        return directory_[segment].load(std::memory_order_acquire)[i - segment_offset(segment)];
+    }
+    inline scalar_at const& operator[](std::size_t i) const noexcept {
+        std::size_t segment = floor_log2((i >> first_segment_bits()) + 1);
+        return directory_[segment].load(std::memory_order_acquire)[i - segment_offset(segment)];
+    }
+
+    std::size_t memory_usage() const noexcept { return size() * sizeof(scalar_at); }
+
+    /**
+     *  @brief  Grows the buffer to fit at least @p capacity zero-initialized entries.
+     *  @return `true` on success, `false` on memory allocation errors or exceeding the addressable range.
+     */
+    bool reserve(std::size_t capacity) noexcept {
+        std::size_t old_segments = segments_.load();
+        std::size_t new_segments = old_segments;
+        while (segment_offset(new_segments) < capacity)
+            if (++new_segments > directory_size())
+                return false;
+        if (new_segments == old_segments)
+            return true;
+
+        // Every segment is published on its own, so the new entries are addressable once the capacity is visible
+        for (std::size_t i = old_segments; i != new_segments; ++i) {
+            scalar_at* segment = segment_allocator_t{}.allocate(segment_size(i));
+            if (!segment) {
+                for (std::size_t j = old_segments; j != i; ++j)
+                    segment_allocator_t{}.deallocate(directory_[j].exchange(nullptr), segment_size(j));
+                return false;
+            }
+            std::memset((void*)segment, 0, segment_size(i) * sizeof(scalar_at));
+            directory_[i].store(segment, std::memory_order_release);
+        }
+        segments_.store(new_segments, std::memory_order_release);
+        return true;
+    }
+
+    void reset() noexcept {
+        std::size_t segments = segments_.load();
+        for (std::size_t i = 0; i != segments; ++i)
+            segment_allocator_t{}.deallocate(directory_[i].exchange(nullptr), segment_size(i));
+        segments_ = 0;
+    }
+};
+
+/**
+ *  @brief  Similar to `bitset_gt`, but stored in a `segmented_buffer_gt`, so its capacity
+ *          can grow while other threads are holding the locks.
+ */
+template <typename allocator_at = std::allocator<byte_t>, std::size_t capacity_bits_ak = sizeof(std::size_t) * CHAR_BIT>
+class segmented_bitset_gt {
+    using compressed_slot_t = unsigned long;
+    using slots_allocator_t = typename std::allocator_traits<allocator_at>::template rebind_alloc<compressed_slot_t>;
+
+    static constexpr std::size_t bits_per_slot() { return sizeof(compressed_slot_t) * CHAR_BIT; }
+    static constexpr compressed_slot_t bits_mask() { return sizeof(compressed_slot_t) * CHAR_BIT - 1; }
+
+    segmented_buffer_gt<compressed_slot_t, slots_allocator_t, capacity_bits_ak> slots_{};
+
+  public:
+    explicit operator bool() const noexcept { return bool(slots_); }
+    std::size_t memory_usage() const noexcept { return slots_.memory_usage(); }
+    bool reserve(std::size_t capacity) noexcept { return slots_.reserve(divide_round_up<bits_per_slot()>(capacity)); }
+    void reset() noexcept { slots_.reset(); }
+    void swap(segmented_bitset_gt& other) noexcept { slots_.swap(other.slots_); }
+
+#if defined(USEARCH_DEFINED_WINDOWS)
+
+    inline bool atomic_set(std::size_t i) noexcept {
+        compressed_slot_t mask{1ul << (i & bits_mask())};
+        return InterlockedOr((long volatile*)&slots_[i / bits_per_slot()], mask) & mask;
+    }
+
+    inline void atomic_reset(std::size_t i) noexcept {
+        compressed_slot_t mask{1ul << (i & bits_mask())};
+        InterlockedAnd((long volatile*)&slots_[i / bits_per_slot()], ~mask);
+    }
+
+#else
+
+    inline bool atomic_set(std::size_t i) noexcept {
+        compressed_slot_t mask{1ul << (i & bits_mask())};
+        return __atomic_fetch_or(&slots_[i / bits_per_slot()], mask, __ATOMIC_ACQUIRE) & mask;
+    }
+
+    inline void atomic_reset(std::size_t i) noexcept {
+        compressed_slot_t mask{1ul << (i & bits_mask())};
+        __atomic_fetch_and(&slots_[i / bits_per_slot()], ~mask, __ATOMIC_RELEASE);
+    }
+
+#endif
+};
+
 /**
  *  @brief  Similar to `std::priority_queue`, but allows raw access to underlying
  *          memory, in case you want to shuffle it or sort. Good for collections
@@ -855,6 +1053,7 @@ class growing_hash_set_gt {
 
     explicit operator bool() const noexcept { return slots_; }
     std::size_t size() const noexcept { return count_; }
+    std::size_t capacity() const noexcept { return capacity_; }
 
     void clear() noexcept {
         std::memset(slots_, 0xFF, capacity_ * sizeof(element_t));
@@ -1002,9 +1201,9 @@ class ring_gt {
     size_t size() const noexcept {
         if (empty_)
             return 0;
-        else if (head_ >= tail_)
+        else if (head_ > tail_)
             return head_ - tail_;
-        else
+        else // Matching `head_` and `tail_` mean a full ring
             return capacity_ - (tail_ - head_);
     }
 
@@ -1057,7 +1256,7 @@ class ring_gt {
         if (head_ == tail_ && !empty_)
             return false; // elements_ is full
 
-        return push(value);
+        push(value);
         return true;
     }
 
@@ -1091,6 +1290,10 @@ constexpr std::size_t default_expansion_search() { return 64; }
 
 constexpr std::size_t default_allocator_entry_bytes() { return 64; }
 
+/// @brief Number of free men a thread claims at once during `join`.
+/// Large enough to amortize the atomic traffic, small enough to balance the load.
+constexpr std::size_t default_join_batch_size() { return 64; }
+
 /**
  *  @brief  Configuration settings for the index construction.
  *          Includes the main `::connectivity` parameter (`M` in the paper)
@@ -1148,6 +1351,106 @@ struct index_search_config_t {
     bool exact = false;
 };
 
+/**
+ *  @brief  Counters of the work done by searches, accumulated per thread, if enabled.
+ *          Helps understand why some queries or some collections are slower than others.
+ */
+struct index_search_stats_t {
+    /// @brief Number of searches performed.
+    std::size_t searches = 0;
+    /// @brief Number of times the distances were computed.
+    std::size_t computed_distances = 0;
+    /// @brief Number of graph nodes, which neighbors lists were traversed.
+    std::size_t visited_members = 0;
+    /// @brief Total size of the visited-sets on the base level.
+    std::size_t visits = 0;
+    /// @brief Total size of the candidates queues left unexplored on the base level.
+    std::size_t next_candidates = 0;
+    /// @brief Total size of the top candidates heaps, before truncation to the wanted size.
+    std::size_t top_candidates = 0;
+    /// @brief Number of candidates rejected by the filtering predicate.
+    std::size_t rejected_members = 0;
+    /// @brief Number of failed attempts to lock a node, concurrently updated by another thread.
+    std::size_t lock_spins = 0;
+    /// @brief Time spent converting the queries into the scalar type of the index, in higher-level wrappers.
+    std::size_t cast_nanoseconds = 0;
+
+    index_search_stats_t& operator+=(index_search_stats_t const& other) noexcept {
+        searches += other.searches;
+        computed_distances += other.computed_distances;
+        visited_members += other.visited_members;
+        visits += other.visits;
+        next_candidates += other.next_candidates;
+        top_candidates += other.top_candidates;
+        rejected_members += other.rejected_members;
+        lock_spins += other.lock_spins;
+        cast_nanoseconds += other.cast_nanoseconds;
+        return *this;
+    }
+};
+
+/**
+ *  @brief  Reads the cheapest monotonic hardware counter: the time-stamp counter on x86,
+ *          the virtual timer on Arm, or the nanoseconds of the steady clock elsewhere.
+ */
+inline std::uint64_t cpu_cycles() noexcept {
+#if defined(USEARCH_DEFINED_X86) && (defined(USEARCH_DEFINED_GCC) || defined(USEARCH_DEFINED_CLANG))
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__) && (defined(USEARCH_DEFINED_GCC) || defined(USEARCH_DEFINED_CLANG))
+    std::uint64_t cycles;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(cycles));
+    return cycles;
+#else
+    return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+/**
+ *  @brief  Breakdown of the time spent inserting entries, in `cpu_cycles()` units.
+ *          Only collected, if compiled with `USEARCH_USE_PROFILING`, otherwise stays zeroed.
+ *
+ *  The `descent`, `search`, `refine` and `reconnect` phases don't overlap, and the remainder
+ *  of the `total` goes to bookkeeping. The `lock` waits overlap with the other phases.
+ */
+struct index_build_stats_t {
+    /// @brief Number of nodes linked into the graph, including updates.
+    std::size_t insertions = 0;
+    /// @brief Time spent linking the nodes into the graph.
+    std::uint64_t total_cycles = 0;
+    /// @brief Time spent greedily descending the upper levels, above the level of the new node.
+    std::uint64_t descent_cycles = 0;
+    /// @brief Time spent in beam searches for the neighbors of the new node, on every level it is present.
+    std::uint64_t search_cycles = 0;
+    /// @brief Time spent in the diversity heuristic, pruning the neighbors lists of new and old nodes.
+    std::uint64_t refine_cycles = 0;
+    /// @brief Time spent measuring distances between the neighbors of new nodes, to add the reverse links.
+    std::uint64_t reconnect_cycles = 0;
+    /// @brief Time insertions spent waiting for the node locks, held by concurrent threads.
+    /// Waits of `search()` calls are not counted here.
+    std::uint64_t lock_cycles = 0;
+
+    index_build_stats_t& operator+=(index_build_stats_t const& other) noexcept {
+        insertions += other.insertions;
+        total_cycles += other.total_cycles;
+        descent_cycles += other.descent_cycles;
+        search_cycles += other.search_cycles;
+        refine_cycles += other.refine_cycles;
+        reconnect_cycles += other.reconnect_cycles;
+        lock_cycles += other.lock_cycles;
+        return *this;
+    }
+};
+
+/// @brief Adds the `cpu_cycles()` passed until the end of the scope to a counter. Used by `usearch_profile_m`.
+class profiled_scope_t {
+    std::uint64_t& cycles_;
+    std::uint64_t start_;
+
+  public:
+    explicit profiled_scope_t(std::uint64_t& cycles) noexcept : cycles_(cycles), start_(cpu_cycles()) {}
+    ~profiled_scope_t() noexcept { cycles_ += cpu_cycles() - start_; }
+};
+
 struct index_cluster_config_t {
     /// @brief Hyper-parameter controlling the quality of search.
     /// Defaults to 16 in FAISS and 10 in hnswlib.
@@ -1171,6 +1474,10 @@ struct index_join_config_t {
 
     /// @brief Brute-forces exhaustive search over all entries in the index.
     bool exact = false;
+
+    /// @brief Number of free men a thread claims at once from the shared queue.
+    /// Zero will use the `default_join_batch_size()`.
+    std::size_t batch_size = 0;
 };
 
 /// @brief  C++17 and newer version deprecate the `std::result_of`
@@ -1768,7 +2075,9 @@ class index_gt {
      */
     static constexpr std::size_t node_head_bytes_() { return sizeof(key_t) + sizeof(level_t); }
 
-    using nodes_mutexes_t = bitset_gt<dynamic_allocator_t>;
+    static constexpr std::size_t slot_bits_() { return sizeof(compressed_slot_t) * CHAR_BIT; }
+
+    using nodes_mutexes_t = segmented_bitset_gt<dynamic_allocator_t, slot_bits_()>;
 
     using visits_hash_set_t = growing_hash_set_gt<compressed_slot_t, hash_gt<compressed_slot_t>, dynamic_allocator_t>;
 
@@ -1868,6 +2177,10 @@ class index_gt {
         std::default_random_engine level_generator{};
         std::size_t iteration_cycles{};
         std::size_t computed_distances_count{};
+        std::size_t rejected_members_count{};
+        std::size_t lock_spins_count{};
+        index_search_stats_t search_stats{};
+        index_build_stats_t build_stats{};
 
         template <typename value_at, typename metric_at, typename entry_at> //
         inline distance_t measure(value_at const& first, entry_at const& second, metric_at&& metric) noexcept {
@@ -1909,16 +2222,29 @@ class index_gt {
     ///         If any thread is updating those values, no other threads can `add()` or `search()`.
     std::mutex global_mutex_{};
 
+    /// @brief  Serializes the `reserve()` calls, without blocking the `add()` and `search()` ones.
+    std::mutex reserve_mutex_{};
+
     /// @brief  The level of the top-most graph in the index. Grows as the logarithm of size, starts from zero.
     level_t max_level_{};
 
     /// @brief  The slot in which the only node of the top-level graph is stored.
     std::size_t entry_slot_{};
 
+    using compressed_slots_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<compressed_slot_t>;
+
+    /// @brief  Optional diverse members of the upper levels, to start the searches from the closest of them.
+    buffer_gt<compressed_slot_t, compressed_slots_allocator_t> entry_points_{};
+
+    /// @brief  Enables accumulating the `context_t::search_stats` on every search.
+    bool search_stats_enabled_{};
+
     using nodes_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<node_t>;
 
-    /// @brief  C-style array of `node_t` smart-pointers.
-    buffer_gt<node_t, nodes_allocator_t> nodes_{};
+    using nodes_t = segmented_buffer_gt<node_t, nodes_allocator_t, slot_bits_()>;
+
+    /// @brief  Segmented array of `node_t` smart-pointers, that doesn't move on growth.
+    nodes_t nodes_{};
 
     /// @brief  Mutex, that limits concurrent access to `nodes_`.
     mutable nodes_mutexes_t nodes_mutexes_{};
@@ -1933,6 +2259,7 @@ class index_gt {
     std::size_t capacity() const noexcept { return nodes_capacity_; }
     std::size_t size() const noexcept { return nodes_count_; }
     std::size_t max_level() const noexcept { return static_cast<std::size_t>(max_level_); }
+    std::size_t level_of(std::size_t slot) const noexcept { return static_cast<std::size_t>(node_at_(slot).level()); }
     index_config_t const& config() const noexcept { return config_; }
     index_limits_t const& limits() const noexcept { return limits_; }
     bool is_immutable() const noexcept { return bool(viewed_file_); }
@@ -2027,6 +2354,7 @@ class index_gt {
         nodes_count_ = 0;
         max_level_ = -1;
         entry_slot_ = 0u;
+        entry_points_ = {};
     }
 
     /**
@@ -2039,9 +2367,9 @@ class index_gt {
     void reset() noexcept {
         clear();
 
-        nodes_ = {};
+        nodes_.reset();
         contexts_ = {};
-        nodes_mutexes_ = {};
+        nodes_mutexes_.reset();
         limits_ = index_limits_t{0, 0};
         nodes_capacity_ = 0;
         viewed_file_ = memory_mapped_file_t{};
@@ -2060,8 +2388,10 @@ class index_gt {
         std::swap(viewed_file_, other.viewed_file_);
         std::swap(max_level_, other.max_level_);
         std::swap(entry_slot_, other.entry_slot_);
-        std::swap(nodes_, other.nodes_);
-        std::swap(nodes_mutexes_, other.nodes_mutexes_);
+        std::swap(entry_points_, other.entry_points_);
+        std::swap(search_stats_enabled_, other.search_stats_enabled_);
+        nodes_.swap(other.nodes_);
+        nodes_mutexes_.swap(other.nodes_mutexes_);
         std::swap(contexts_, other.contexts_);
 
         // Non-atomic parts.
@@ -2075,30 +2405,33 @@ class index_gt {
 
     /**
      *  @brief  Increases the `capacity()` of the index to allow adding more vectors.
+     *          Never shrinks it. Growing the number of members may run concurrently with `add()`
+     *          and `search()`, as the nodes are stored in segments, each twice as large as the previous one,
+     *          that are never moved once allocated.
+     *          Growing the number of threads reallocates the contexts, and must not overlap with them.
      *  @return `true` on success, `false` on memory allocation errors.
      */
     bool reserve(index_limits_t limits) usearch_noexcept_m {
+        std::unique_lock<std::mutex> lock(reserve_mutex_);
+        limits.members = (std::max)(limits.members, limits_.members);
+        limits.threads_add = (std::max)(limits.threads_add, limits_.threads_add);
+        limits.threads_search = (std::max)(limits.threads_search, limits_.threads_search);
+
+        if (limits.threads() > contexts_.size()) {
+            buffer_gt<context_t, contexts_allocator_t> new_contexts(limits.threads());
+            if (!new_contexts)
+                return false;
+            for (std::size_t i = 0; i != contexts_.size(); ++i)
+                std::swap(new_contexts[i], contexts_[i]);
+            contexts_ = std::move(new_contexts);
+        }
 
-        if (limits.threads_add <= limits_.threads_add          //
-            && limits.threads_search <= limits_.threads_search //
-            && limits.members <= limits_.members)
-            return true;
-
-        nodes_mutexes_t new_mutexes(limits.members);
-        buffer_gt<node_t, nodes_allocator_t> new_nodes(limits.members);
-        buffer_gt<context_t, contexts_allocator_t> new_contexts(limits.threads());
-        if (!new_nodes || !new_contexts || !new_mutexes)
+        // The locks must be addressable before any thread can observe the new capacity.
+        if (!nodes_mutexes_.reserve(limits.members) || !nodes_.reserve(limits.members))
             return false;
 
-        // Move the nodes info, and deallocate previous buffers.
-        if (nodes_)
-            std::memcpy(new_nodes.data(), nodes_.data(), sizeof(node_t) * size());
-
         limits_ = limits;
         nodes_capacity_ = limits.members;
-        nodes_ = std::move(new_nodes);
-        contexts_ = std::move(new_contexts);
-        nodes_mutexes_ = std::move(new_mutexes);
         return true;
     }
 
@@ -2152,12 +2485,12 @@ class index_gt {
     };
 
     class search_result_t {
-        node_t const* nodes_{};
+        index_gt const* index_{};
         top_candidates_t const* top_{};
 
         friend class index_gt;
         inline search_result_t(index_gt const& index, top_candidates_t& top) noexcept
-            : nodes_(index.nodes_), top_(&top) {}
+            : index_(&index), top_(&top) {}
 
       public:
         /** @brief  Number of search results found. */
@@ -2166,6 +2499,10 @@ class index_gt {
         std::size_t visited_members{};
         /** @brief  Number of times the distances were computed. */
         std::size_t computed_distances{};
+        /** @brief  Number of candidates rejected by the filtering predicate. */
+        std::size_t rejected_members{};
+        /** @brief  Number of failed attempts to lock a node, concurrently updated by another thread. */
+        std::size_t lock_spins{};
         error_t error{};
 
         inline search_result_t() noexcept {}
@@ -2193,7 +2530,7 @@ class index_gt {
         inline match_t at(std::size_t i) const noexcept {
             candidate_t const* top_ordered = top_->data();
             candidate_t candidate = top_ordered[i];
-            node_t node = nodes_[candidate.slot];
+            node_t node = index_->node_at_(candidate.slot);
             return {member_cref_t{node.ckey(), candidate.slot}, candidate.distance};
         }
         inline std::size_t merge_into(          //
@@ -2280,6 +2617,13 @@ class index_gt {
         if (is_immutable())
             return result.failed("Can't add to an immutable index");
 
+        // Every `add__start` is matched by an `add__end`, that has no valid slot, if the insertion failed
+        usearch_trace_m(add__start, config.thread);
+        auto failed = [&](char const* message) -> add_result_t {
+            usearch_trace_m(add__end, config.thread, std::numeric_limits<std::size_t>::max(), 0, 0);
+            return result.failed(message);
+        };
+
         // Make sure we have enough local memory to perform this request
         context_t& context = contexts_[config.thread];
         top_candidates_t& top = context.top_candidates;
@@ -2292,9 +2636,9 @@ class index_gt {
         std::size_t connectivity_max = (std::max)(config_.connectivity_base, config_.connectivity);
         std::size_t top_limit = (std::max)(connectivity_max + 1, config.expansion);
         if (!top.reserve(top_limit))
-            return result.failed("Out of memory!");
+            return failed("Out of memory!");
         if (!next.reserve(config.expansion))
-            return result.failed("Out of memory!");
+            return failed("Out of memory!");
 
         // Determining how much memory to allocate for the node depends on the target level
         std::unique_lock<std::mutex> new_level_lock(global_mutex_);
@@ -2307,14 +2651,14 @@ class index_gt {
         std::size_t new_slot = nodes_count_.fetch_add(1);
         if (new_slot >= capacity) {
             nodes_count_.fetch_sub(1);
-            return result.failed("Reserve capacity ahead of insertions!");
+            return failed("Reserve capacity ahead of insertions!");
         }
 
         // Allocate the neighbors
         node_t node = node_make_(key, target_level);
         if (!node) {
             nodes_count_.fetch_sub(1);
-            return result.failed("Out of memory!");
+            return failed("Out of memory!");
         }
         if (target_level <= max_level_copy)
             new_level_lock.unlock();
@@ -2329,6 +2673,7 @@ class index_gt {
         if (!new_slot) {
             entry_slot_ = new_slot;
             max_level_ = target_level;
+            usearch_trace_m(add__end, config.thread, new_slot, target_level, 0);
             return result;
         }
 
@@ -2350,6 +2695,7 @@ class index_gt {
             entry_slot_ = new_slot;
             max_level_ = target_level;
         }
+        usearch_trace_m(add__end, config.thread, new_slot, target_level, result.computed_distances);
         return result;
     }
 
@@ -2463,39 +2809,251 @@ class index_gt {
         if (!nodes_count_)
             return result;
 
+        usearch_trace_m(search__start, config.thread, wanted);
+        auto failed = [&](char const* message) -> search_result_t {
+            usearch_trace_m(search__end, config.thread, 0, 0);
+            return result.failed(message);
+        };
+
         // Go down the level, tracking only the closest match
         result.computed_distances = context.computed_distances_count;
         result.visited_members = context.iteration_cycles;
+        result.rejected_members = context.rejected_members_count;
+        result.lock_spins = context.lock_spins_count;
 
         if (config.exact) {
             if (!top.reserve(wanted))
-                return result.failed("Out of memory!");
+                return failed("Out of memory!");
             search_exact_(query, metric, predicate, wanted, context);
         } else {
             next_candidates_t& next = context.next_candidates;
             std::size_t expansion = (std::max)(config.expansion, wanted);
             if (!next.reserve(expansion))
-                return result.failed("Out of memory!");
+                return failed("Out of memory!");
             if (!top.reserve(expansion))
-                return result.failed("Out of memory!");
+                return failed("Out of memory!");
 
-            std::size_t closest_slot = search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context);
+            std::size_t closest_slot = search_for_entry_(query, metric, prefetch, context);
 
             // For bottom layer we need a more optimized procedure
             if (!search_to_find_in_base_(query, metric, predicate, prefetch, closest_slot, expansion, context))
-                return result.failed("Out of memory!");
+                return failed("Out of memory!");
         }
 
+        normalize_search_stats_(result, context, !config.exact);
         top.sort_ascending();
         top.shrink(wanted);
+        result.count = top.size();
+        usearch_trace_m(search__end, config.thread, result.count, result.computed_distances);
+        return result;
+    }
 
-        // Normalize stats
-        result.computed_distances = context.computed_distances_count - result.computed_distances;
-        result.visited_members = context.iteration_cycles - result.visited_members;
+    /**
+     *  @brief Searches for the closest elements to the given ::query, starting the traversal
+     *         from an existing member on the base level, instead of descending from the entry point.
+     *         Ideal for queries known to land close to ::start_slot, like the member's own vector. Thread-safe.
+     *
+     *  @param[in] start_slot The slot of the member to start the traversal from.
+     *  @param[in] query Content that will be compared against other entries in the index.
+     *  @param[in] wanted The upper bound for the number of results to return.
+     *  @param[in] config Configuration options for this specific operation.
+     *  @param[in] predicate Optional filtering predicate for `member_cref_t`.
+     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     */
+    template <                                     //
+        typename value_at,                         //
+        typename metric_at,                        //
+        typename predicate_at = dummy_predicate_t, //
+        typename prefetch_at = dummy_prefetch_t    //
+        >
+    search_result_t search_around(                 //
+        std::size_t start_slot,                    //
+        value_at&& query,                          //
+        std::size_t wanted,                        //
+        metric_at&& metric,                        //
+        index_search_config_t config = {},         //
+        predicate_at&& predicate = predicate_at{}, //
+        prefetch_at&& prefetch = prefetch_at{}) const noexcept {
+
+        context_t& context = contexts_[config.thread];
+        top_candidates_t& top = context.top_candidates;
+        search_result_t result{*this, top};
+        if (!nodes_count_)
+            return result;
+        if (start_slot >= size())
+            return result.failed("Starting slot is out of bounds");
+
+        // Skip the descent, going straight for the bottom layer
+        result.computed_distances = context.computed_distances_count;
+        result.visited_members = context.iteration_cycles;
+        result.rejected_members = context.rejected_members_count;
+        result.lock_spins = context.lock_spins_count;
+
+        next_candidates_t& next = context.next_candidates;
+        std::size_t expansion = (std::max)(config.expansion, wanted);
+        if (!next.reserve(expansion))
+            return result.failed("Out of memory!");
+        if (!top.reserve(expansion))
+            return result.failed("Out of memory!");
+        if (!search_to_find_in_base_(query, metric, predicate, prefetch, start_slot, expansion, context))
+            return result.failed("Out of memory!");
+
+        normalize_search_stats_(result, context, true);
+        top.sort_ascending();
+        top.shrink(wanted);
+        result.count = top.size();
+        return result;
+    }
+
+    /**
+     *  @brief Wraps previously found matches into a `search_result_t`, as if they were just found,
+     *         reusing the thread-local memory of the regular `search()`. Designed for result caches.
+     *
+     *  @param[in] slots Slots of the matches, sorted by distance.
+     *  @param[in] distances Distances to the matches, in ascending order.
+     *  @param[in] count Number of the matches.
+     *  @param[in] thread Thread identifier, which context will hold the matches.
+     *  @return Smart object referencing temporary memory. Valid until next `search()`, `add()`, or `cluster()`.
+     */
+    search_result_t search_result_from(                              //
+        compressed_slot_t const* slots, distance_t const* distances, //
+        std::size_t count, std::size_t thread) const noexcept {
+
+        context_t& context = contexts_[thread];
+        top_candidates_t& top = context.top_candidates;
+        search_result_t result{*this, top};
+        top.clear();
+        if (!top.reserve(count))
+            return result.failed("Out of memory!");
+        for (std::size_t i = 0; i != count; ++i)
+            top.insert_reserved({distances[i], slots[i]});
         result.count = top.size();
         return result;
     }
 
+    /**
+     *  @brief Picks up to ::count diverse members from the upper levels of the graph, so that the following
+     *         searches start from the closest of them, instead of descending from the single entry point.
+     *         Helps clustered query distributions, skipping most of the upper-level hops.
+     *
+     *  The candidates are the members of the highest levels, a few times more than ::count,
+     *  from which the mutually farthest are picked greedily, starting with the global entry point.
+     *  Not thread-safe, can't be called concurrently with `add()`, `search()`, or `compact()`.
+     *
+     *  @param[in] count The number of entry points to keep. Zero disables them.
+     *  @param[in] metric Callable object measuring distance between two members.
+     *  @param[in] thread Thread identifier, which context will be used for distance computations.
+     *  @return `true` on success, `false` if run out of memory.
+     */
+    template <typename metric_at>
+    bool refresh_entry_points(std::size_t count, metric_at&& metric, std::size_t thread = 0) noexcept {
+
+        entry_points_ = {};
+        std::size_t const nodes_count = nodes_count_;
+        if (!count || !nodes_count)
+            return true;
+
+        using size_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
+        using distances_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<distance_t>;
+        std::size_t const candidates_limit = (std::min)(count * 4, nodes_count);
+        buffer_gt<std::size_t, size_allocator_t> level_sizes(static_cast<std::size_t>(max_level_) + 1);
+        buffer_gt<compressed_slot_t, compressed_slots_allocator_t> candidates(candidates_limit);
+        buffer_gt<distance_t, distances_allocator_t> distances(candidates_limit);
+        if (!level_sizes || !candidates || !distances)
+            return false;
+
+        // Find the lowest level, above which there are not enough candidates
+        std::fill(level_sizes.begin(), level_sizes.end(), 0u);
+        for (std::size_t slot = 0; slot != nodes_count; ++slot)
+            ++level_sizes[static_cast<std::size_t>(node_at_(slot).level())];
+        level_t threshold = max_level_;
+        std::size_t higher = 0;
+        while (threshold > 0 && higher + level_sizes[static_cast<std::size_t>(threshold)] < candidates_limit)
+            higher += level_sizes[static_cast<std::size_t>(threshold--)];
+
+        // Take everything above the threshold level, and as much as fits from it
+        std::size_t candidates_count = 0;
+        candidates[candidates_count++] = static_cast<compressed_slot_t>(entry_slot_);
+        for (std::size_t slot = 0; slot != nodes_count && candidates_count != candidates_limit; ++slot)
+            if (slot != entry_slot_ && node_at_(slot).level() > threshold)
+                candidates[candidates_count++] = static_cast<compressed_slot_t>(slot);
+        for (std::size_t slot = 0; slot != nodes_count && candidates_count != candidates_limit; ++slot)
+            if (slot != entry_slot_ && node_at_(slot).level() == threshold)
+                candidates[candidates_count++] = static_cast<compressed_slot_t>(slot);
+
+        // Greedily move the candidate farthest from all the picked ones to the front
+        context_t& context = contexts_[thread];
+        for (std::size_t i = 1; i != candidates_count; ++i)
+            distances[i] = context.measure(citerator_at(candidates[0]), citerator_at(candidates[i]), metric);
+        std::size_t picked = 1;
+        for (; picked != (std::min)(count, candidates_count); ++picked) {
+            std::size_t farthest = picked;
+            for (std::size_t i = picked + 1; i != candidates_count; ++i)
+                if (distances[i] > distances[farthest])
+                    farthest = i;
+            std::swap(candidates[picked], candidates[farthest]);
+            std::swap(distances[picked], distances[farthest]);
+            for (std::size_t i = picked + 1; i != candidates_count; ++i) {
+                member_citerator_t candidate = citerator_at(candidates[i]);
+                distance_t dist = context.measure(citerator_at(candidates[picked]), candidate, metric);
+                distances[i] = (std::min)(distances[i], dist);
+            }
+        }
+
+        buffer_gt<compressed_slot_t, compressed_slots_allocator_t> entry_points(picked);
+        if (!entry_points)
+            return false;
+        std::copy(candidates.begin(), candidates.begin() + picked, entry_points.begin());
+        entry_points_ = std::move(entry_points);
+        return true;
+    }
+
+    /// @brief The number of entry points, picked by `refresh_entry_points()`.
+    std::size_t entry_points() const noexcept { return entry_points_.size(); }
+
+    /**
+     *  @brief Enables accumulating the `index_search_stats_t` counters in every thread context.
+     *         Disabled by default. The counters survive the contexts growing in `reserve()`,
+     *         and are only zeroed by `reset_search_stats()`.
+     */
+    void enable_search_stats(bool enabled = true) noexcept { search_stats_enabled_ = enabled; }
+    bool search_stats_enabled() const noexcept { return search_stats_enabled_; }
+
+    /**
+     *  @brief Aggregates the search counters of all the threads. The thread-local counters are not atomic,
+     *         so the snapshot is only approximate, if taken while other threads are searching.
+     */
+    index_search_stats_t search_stats() const noexcept {
+        index_search_stats_t result;
+        for (std::size_t i = 0; i != contexts_.size(); ++i)
+            result += contexts_[i].search_stats;
+        return result;
+    }
+
+    /// @brief Counters of a single thread, for the higher-level wrappers to account their own work.
+    index_search_stats_t& search_stats(std::size_t thread) const noexcept { return contexts_[thread].search_stats; }
+
+    void reset_search_stats() noexcept {
+        for (std::size_t i = 0; i != contexts_.size(); ++i)
+            contexts_[i].search_stats = {};
+    }
+
+    /**
+     *  @brief Aggregates the per-phase timings of insertions from all the threads.
+     *         Stays zeroed, unless compiled with `USEARCH_USE_PROFILING`.
+     */
+    index_build_stats_t build_stats() const noexcept {
+        index_build_stats_t result;
+        for (std::size_t i = 0; i != contexts_.size(); ++i)
+            result += contexts_[i].build_stats;
+        return result;
+    }
+
+    void reset_build_stats() noexcept {
+        for (std::size_t i = 0; i != contexts_.size(); ++i)
+            contexts_[i].build_stats = {};
+    }
+
     /**
      *  @brief Identifies the closest cluster to the gived ::query. Thread-safe.
      *
@@ -2591,6 +3149,252 @@ class index_gt {
         return result;
     }
 
+    using sizes_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
+
+    /**
+     *  @brief  Structural health of a single graph level. Members rejected by the predicate are
+     *          treated as tombstones, that still route the searches, but are never returned.
+     */
+    struct health_t {
+        error_t error{};
+        /// @brief Members present on the level, including the banned ones.
+        std::size_t nodes{};
+        std::size_t banned_nodes{};
+        /// @brief Allowed members reachable from the entry point, following the links of this level.
+        std::size_t reachable_nodes{};
+        /// @brief Allowed members without incoming links, a subset of the unreachable ones.
+        std::size_t orphan_nodes{};
+        std::size_t edges{};
+        /// @brief Links leading to banned members, removed by `isolate` and `compact`.
+        std::size_t banned_edges{};
+        std::size_t max_degree{};
+        /// @brief Average distance between the allowed members and their neighbors.
+        double mean_neighbor_distance{};
+        /// @brief Number of nodes with `i` outgoing links, for `i` in [0, `max_degree`].
+        buffer_gt<std::size_t, sizes_allocator_t> out_degrees{};
+        /// @brief Number of nodes with `i` incoming links, the last bin also counting the higher degrees.
+        buffer_gt<std::size_t, sizes_allocator_t> in_degrees{};
+
+        std::size_t unreachable_nodes() const noexcept { return nodes - banned_nodes - reachable_nodes; }
+        explicit operator bool() const noexcept { return !error; }
+        health_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    struct repair_result_t {
+        error_t error{};
+        /// @brief Number of unreachable members, linked back into the graph.
+        std::size_t reconnected{};
+
+        explicit operator bool() const noexcept { return !error; }
+        repair_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    /**
+     *  @brief  Diagnoses the connectivity of one graph ::level: reachability from the entry point,
+     *          degree distributions, links to banned members, and the average length of links.
+     *          Helps decide, when the index should be compacted or repaired after heavy churn.
+     *          Can't be called concurrently with `add`, `update` or `compact`.
+     *
+     *  @param[in] allow_member Predicate, rejecting the removed members, like tombstones.
+     *  @param[in] executor Thread-pool to compute the distances in parallel.
+     */
+    template <                                        //
+        typename metric_at,                           //
+        typename allow_member_at = dummy_predicate_t, //
+        typename executor_at = dummy_executor_t,      //
+        typename progress_at = dummy_progress_t       //
+        >
+    health_t health(                                        //
+        std::size_t level, metric_at&& metric,              //
+        allow_member_at&& allow_member = allow_member_at{}, //
+        executor_at&& executor = executor_at{},             //
+        progress_at&& progress = progress_at{}) const noexcept {
+
+        health_t result;
+        std::size_t const nodes_count = nodes_count_;
+        std::size_t const max_degree = level ? config_.connectivity : config_.connectivity_base;
+        std::size_t const threads_count = contexts_.size();
+        result.max_degree = max_degree;
+        result.out_degrees = buffer_gt<std::size_t, sizes_allocator_t>(max_degree + 1);
+        result.in_degrees = buffer_gt<std::size_t, sizes_allocator_t>(max_degree + 1);
+        if (!result.out_degrees || !result.in_degrees)
+            return result.failed("Out of memory!");
+        std::fill(result.out_degrees.begin(), result.out_degrees.end(), 0u);
+        std::fill(result.in_degrees.begin(), result.in_degrees.end(), 0u);
+        if (!nodes_count || static_cast<std::size_t>(max_level_) < level)
+            return result;
+
+        // Every executor thread needs a context, so wider executors can't be served
+        if (executor.size() > threads_count)
+            return result.failed("Executor has more threads than the index was reserved for");
+
+        // Outgoing links are measured in parallel, keeping partial sums per thread
+        struct partial_t {
+            std::size_t edges;
+            std::size_t banned_edges;
+            std::size_t measured_edges;
+            double distances;
+        };
+        using partials_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<partial_t>;
+        buffer_gt<partial_t, partials_allocator_t> partials(threads_count);
+        buffer_gt<std::size_t, sizes_allocator_t> out_degrees(threads_count * (max_degree + 1));
+        buffer_gt<compressed_slot_t, compressed_slots_allocator_t> in_degrees(nodes_count);
+        bitset_gt<dynamic_allocator_t> banned(nodes_count);
+        if (!partials || !out_degrees || !in_degrees || !banned)
+            return result.failed("Out of memory!");
+        std::fill(partials.begin(), partials.end(), partial_t{0, 0, 0, 0});
+        std::fill(out_degrees.begin(), out_degrees.end(), 0u);
+        std::fill(in_degrees.begin(), in_degrees.end(), 0u);
+
+        for (std::size_t slot = 0; slot != nodes_count; ++slot)
+            if (!allow_member(at(slot)))
+                banned.set(slot);
+
+        executor.fixed(nodes_count, [&](std::size_t thread, std::size_t slot) {
+            node_t node = node_at_(slot);
+            if (static_cast<std::size_t>(node.level()) < level)
+                return;
+            partial_t& partial = partials[thread];
+            context_t& context = contexts_[thread];
+            neighbors_ref_t neighbors = neighbors_(node, static_cast<level_t>(level));
+            bool const measured = !banned.test(slot);
+            out_degrees[thread * (max_degree + 1) + (std::min)(neighbors.size(), max_degree)]++;
+            partial.edges += neighbors.size();
+            for (compressed_slot_t neighbor_slot : neighbors) {
+                partial.banned_edges += banned.test(neighbor_slot);
+                if (!measured)
+                    continue;
+                partial.distances += context.measure(citerator_at(slot), citerator_at(neighbor_slot), metric);
+                partial.measured_edges++;
+            }
+            progress(slot, nodes_count);
+        });
+
+        std::size_t measured_edges = 0;
+        double distances = 0;
+        for (std::size_t thread = 0; thread != threads_count; ++thread) {
+            result.edges += partials[thread].edges;
+            result.banned_edges += partials[thread].banned_edges;
+            measured_edges += partials[thread].measured_edges;
+            distances += partials[thread].distances;
+            for (std::size_t degree = 0; degree <= max_degree; ++degree)
+                result.out_degrees[degree] += out_degrees[thread * (max_degree + 1) + degree];
+        }
+        result.mean_neighbor_distance = measured_edges ? distances / measured_edges : 0;
+
+        // Incoming links are cheap to count, but would need atomics in parallel
+        for (std::size_t slot = 0; slot != nodes_count; ++slot) {
+            node_t node = node_at_(slot);
+            if (static_cast<std::size_t>(node.level()) < level)
+                continue;
+            for (compressed_slot_t neighbor_slot : neighbors_(node, static_cast<level_t>(level)))
+                in_degrees[neighbor_slot]++;
+        }
+
+        bitset_gt<dynamic_allocator_t> reachable;
+        if (!reachable_(level, reachable))
+            return result.failed("Out of memory!");
+        for (std::size_t slot = 0; slot != nodes_count; ++slot) {
+            if (static_cast<std::size_t>(node_at_(slot).level()) < level)
+                continue;
+            result.nodes++;
+            result.in_degrees[(std::min<std::size_t>)(in_degrees[slot], max_degree)]++;
+            if (banned.test(slot))
+                result.banned_nodes++;
+            else if (reachable.test(slot))
+                result.reachable_nodes++;
+            else if (!in_degrees[slot])
+                result.orphan_nodes++;
+        }
+        return result;
+    }
+
+    /**
+     *  @brief  Links the allowed members, unreachable from the entry point on the base level,
+     *          back into the graph, as if they were inserted anew. Upper levels are only used to route
+     *          the searches to the base level, so their islands are left intact. Not thread-safe.
+     *
+     *  @param[in] allow_member Predicate, rejecting the removed members, which don't need repairs.
+     */
+    template <                                        //
+        typename metric_at,                           //
+        typename allow_member_at = dummy_predicate_t, //
+        typename progress_at = dummy_progress_t,      //
+        typename prefetch_at = dummy_prefetch_t       //
+        >
+    repair_result_t repair(                                 //
+        metric_at&& metric,                                 //
+        allow_member_at&& allow_member = allow_member_at{}, //
+        index_update_config_t config = {},                  //
+        progress_at&& progress = progress_at{},             //
+        prefetch_at&& prefetch = prefetch_at{}) usearch_noexcept_m {
+
+        repair_result_t result;
+        bitset_gt<dynamic_allocator_t> reachable;
+        if (!nodes_count_)
+            return result;
+        if (!reachable_(0, reachable))
+            return result.failed("Out of memory!");
+
+        context_t& context = contexts_[config.thread];
+        std::size_t connectivity_max = (std::max)(config_.connectivity_base, config_.connectivity);
+        if (!context.top_candidates.reserve((std::max)(connectivity_max + 1, config.expansion)) ||
+            !context.next_candidates.reserve(config.expansion))
+            return result.failed("Out of memory!");
+
+        std::size_t const nodes_count = nodes_count_;
+        for (std::size_t slot = 0; slot != nodes_count; ++slot) {
+            progress(slot, nodes_count);
+            if (reachable.test(slot) || !allow_member(at(slot)))
+                continue;
+
+            // The outgoing links are rebuilt from scratch, as `connect_new_node_` expects blank lists
+            node_t node = node_at_(slot);
+            for (level_t level = 0; level <= node.level(); ++level)
+                neighbors_(node, level).clear();
+            connect_node_across_levels_(                 //
+                citerator_at(slot), metric, prefetch,    //
+                slot, entry_slot_, max_level_, node.level(), config, context);
+            result.reconnected++;
+        }
+        return result;
+    }
+
+    /**
+     *  @brief  Memory consumed by the graph, split by data-structure.
+     *          Excludes the slack in the `tape_allocator` arenas, which depends on its type.
+     */
+    struct memory_stats_t {
+        /// @brief Keys, levels and neighbors lists of the nodes, not counting the memory-mapped ones.
+        std::size_t nodes{};
+        /// @brief Pointers to the nodes and their spin-locks, proportional to the capacity.
+        std::size_t slots{};
+        /// @brief Thread-local search buffers, proportional to the number of threads.
+        std::size_t contexts{};
+    };
+
+    memory_stats_t memory_stats() const noexcept {
+        memory_stats_t result;
+        if (!viewed_file_)
+            result.nodes = stats().allocated_bytes;
+        result.slots = nodes_.memory_usage() + nodes_mutexes_.memory_usage() +
+                       entry_points_.size() * sizeof(compressed_slot_t);
+        for (std::size_t i = 0; i != contexts_.size(); ++i) {
+            context_t const& context = contexts_[i];
+            result.contexts += sizeof(context_t);
+            result.contexts += context.top_candidates.capacity() * sizeof(candidate_t);
+            result.contexts += context.next_candidates.capacity() * sizeof(candidate_t);
+            result.contexts += context.visits.capacity() * sizeof(compressed_slot_t);
+        }
+        return result;
+    }
+
     /**
      *  @brief  A relatively accurate lower bound on the amount of memory consumed by the system.
      *          In practice it's error will be below 10%.
@@ -2883,8 +3687,10 @@ class index_gt {
             old_slot_to_new[slots_and_levels[new_slot].old_slot] = new_slot;
 
         // Erase all the incoming links
-        buffer_gt<node_t, nodes_allocator_t> reordered_nodes(slots_and_levels.size());
+        nodes_t reordered_nodes;
         tape_allocator_t reordered_tape;
+        if (!reordered_nodes.reserve(nodes_capacity_))
+            return;
 
         for (std::size_t new_slot = 0; new_slot != slots_and_levels.size(); ++new_slot) {
             std::size_t old_slot = slots_and_levels[new_slot].old_slot;
@@ -2914,6 +3720,8 @@ class index_gt {
         nodes_ = std::move(reordered_nodes);
         tape_allocator_ = std::move(reordered_tape);
         entry_slot_ = old_slot_to_new[entry_slot_];
+        for (compressed_slot_t& entry_point : entry_points_)
+            entry_point = static_cast<compressed_slot_t>(old_slot_to_new[entry_point]);
     }
 
     /**
@@ -3034,21 +3842,77 @@ class index_gt {
         return {nodes_mutexes_, slot};
     }
 
+    /// @brief  Counts the contended spins, but only the waits of insertions are timed into `build_stats`.
+    template <bool inserting_ak>
+    inline node_lock_t node_lock_(std::size_t slot, context_t& context) const noexcept {
+        if (nodes_mutexes_.atomic_set(slot)) {
+#if USEARCH_USE_PROFILING
+            std::uint64_t const waiting_start = inserting_ak ? cpu_cycles() : 0;
+#endif
+            std::size_t spins = 0;
+            do
+                spins++;
+            while (nodes_mutexes_.atomic_set(slot));
+            context.lock_spins_count += spins;
+#if USEARCH_USE_PROFILING
+            if (inserting_ak)
+                context.build_stats.lock_cycles += cpu_cycles() - waiting_start;
+#endif
+            usearch_trace_m(lock__contended, slot, spins);
+        }
+        return {nodes_mutexes_, slot};
+    }
+
+    /**
+     *  @brief  Marks the nodes reachable from the `entry_slot_`, following the links of one ::level,
+     *          regardless of predicates, just like the searches do.
+     */
+    bool reachable_(std::size_t level, bitset_gt<dynamic_allocator_t>& reachable) const noexcept {
+        std::size_t const nodes_count = nodes_count_;
+        reachable = bitset_gt<dynamic_allocator_t>(nodes_count);
+        buffer_gt<compressed_slot_t, compressed_slots_allocator_t> queue(nodes_count);
+        if (!reachable || !queue)
+            return false;
+
+        std::size_t queue_begin = 0, queue_end = 0;
+        queue[queue_end++] = static_cast<compressed_slot_t>(entry_slot_);
+        reachable.set(entry_slot_);
+        while (queue_begin != queue_end) {
+            node_t node = node_at_(queue[queue_begin++]);
+            for (compressed_slot_t neighbor_slot : neighbors_(node, static_cast<level_t>(level)))
+                if (!reachable.set(neighbor_slot))
+                    queue[queue_end++] = neighbor_slot;
+        }
+        return true;
+    }
+
     template <typename value_at, typename metric_at, typename prefetch_at>
     void connect_node_across_levels_(                                                           //
         value_at&& value, metric_at&& metric, prefetch_at&& prefetch,                           //
         std::size_t node_slot, std::size_t entry_slot, level_t max_level, level_t target_level, //
         index_update_config_t const& config, context_t& context) usearch_noexcept_m {
 
+#if USEARCH_USE_PROFILING
+        context.build_stats.insertions++;
+#endif
+        usearch_profile_m(inserting, context.build_stats.total_cycles);
+
         // Go down the level, tracking only the closest match
-        std::size_t closest_slot = search_for_one_( //
-            value, metric, prefetch,                //
-            entry_slot, max_level, target_level, context);
+        std::size_t closest_slot;
+        {
+            usearch_profile_m(descending, context.build_stats.descent_cycles);
+            closest_slot = search_for_one_<true>( //
+                value, metric, prefetch,          //
+                entry_slot, max_level, target_level, context);
+        }
 
         // From `target_level` down perform proper extensive search
         for (level_t level = (std::min)(target_level, max_level); level >= 0; --level) {
             // TODO: Handle out of memory conditions
-            search_to_insert_(value, metric, prefetch, closest_slot, node_slot, level, config.expansion, context);
+            {
+                usearch_profile_m(searching, context.build_stats.search_cycles);
+                search_to_insert_(value, metric, prefetch, closest_slot, node_slot, level, config.expansion, context);
+            }
             closest_slot = connect_new_node_(metric, node_slot, level, context);
             reconnect_neighbor_nodes_(metric, node_slot, value, level, context);
         }
@@ -3091,7 +3955,7 @@ class index_gt {
         for (compressed_slot_t close_slot : new_neighbors) {
             if (close_slot == new_slot)
                 continue;
-            node_lock_t close_lock = node_lock_(close_slot);
+            node_lock_t close_lock = node_lock_<true>(close_slot, context);
             node_t close_node = node_at_(close_slot);
 
             neighbors_ref_t close_header = neighbors_(close_node, level);
@@ -3109,11 +3973,15 @@ class index_gt {
             // To fit a new connection we need to drop an existing one.
             top.clear();
             usearch_assert_m((top.reserve(close_header.size() + 1)), "The memory must have been reserved in `add`");
-            top.insert_reserved(
-                {context.measure(value, citerator_at(close_slot), metric), static_cast<compressed_slot_t>(new_slot)});
-            for (compressed_slot_t successor_slot : close_header)
-                top.insert_reserved(
-                    {context.measure(citerator_at(close_slot), citerator_at(successor_slot), metric), successor_slot});
+            {
+                usearch_profile_m(reconnecting, context.build_stats.reconnect_cycles);
+                top.insert_reserved({context.measure(value, citerator_at(close_slot), metric),
+                                     static_cast<compressed_slot_t>(new_slot)});
+                for (compressed_slot_t successor_slot : close_header)
+                    top.insert_reserved(
+                        {context.measure(citerator_at(close_slot), citerator_at(successor_slot), metric),
+                         successor_slot});
+            }
 
             // Export the results:
             close_header.clear();
@@ -3191,7 +4059,58 @@ class index_gt {
         candidates_iterator_t end() const noexcept { return {index, neighbors, visits, neighbors.size()}; }
     };
 
+    /**
+     *  @brief  Turns the snapshots of the context counters in the ::result into deltas,
+     *          and accumulates them, if the search stats are enabled. Must precede the truncation
+     *          of the top candidates. The base level data-structures are only valid after ::traversed.
+     */
+    void normalize_search_stats_(search_result_t& result, context_t& context, bool traversed) const noexcept {
+        result.computed_distances = context.computed_distances_count - result.computed_distances;
+        result.visited_members = context.iteration_cycles - result.visited_members;
+        result.rejected_members = context.rejected_members_count - result.rejected_members;
+        result.lock_spins = context.lock_spins_count - result.lock_spins;
+        if (!search_stats_enabled_)
+            return;
+
+        index_search_stats_t& stats = context.search_stats;
+        stats.searches++;
+        stats.computed_distances += result.computed_distances;
+        stats.visited_members += result.visited_members;
+        stats.rejected_members += result.rejected_members;
+        stats.lock_spins += result.lock_spins;
+        stats.top_candidates += context.top_candidates.size();
+        if (traversed) {
+            stats.visits += context.visits.size();
+            stats.next_candidates += context.next_candidates.size();
+        }
+    }
+
+    /**
+     *  @brief  Descends to the base level, starting from the closest of the `entry_points_`,
+     *          or from the `entry_slot_` at the top level, if there are none.
+     *  @return The slot to start the base level traversal from.
+     */
     template <typename value_at, typename metric_at, typename prefetch_at = dummy_prefetch_t>
+    std::size_t search_for_entry_( //
+        value_at&& query, metric_at&& metric, prefetch_at&& prefetch, context_t& context) const noexcept {
+
+        if (!entry_points_)
+            return search_for_one_(query, metric, prefetch, entry_slot_, max_level_, 0, context);
+
+        // A linear scan over a handful of entry points is cheaper than the hops they replace
+        std::size_t closest_slot = entry_points_[0];
+        distance_t closest_dist = context.measure(query, citerator_at(closest_slot), metric);
+        for (std::size_t i = 1; i != entry_points_.size(); ++i) {
+            distance_t dist = context.measure(query, citerator_at(entry_points_[i]), metric);
+            if (dist < closest_dist) {
+                closest_dist = dist;
+                closest_slot = entry_points_[i];
+            }
+        }
+        return search_for_one_(query, metric, prefetch, closest_slot, node_at_(closest_slot).level(), 0, context);
+    }
+
+    template <bool inserting_ak = false, typename value_at, typename metric_at, typename prefetch_at = dummy_prefetch_t>
     std::size_t search_for_one_(                                      //
         value_at&& query, metric_at&& metric, prefetch_at&& prefetch, //
         std::size_t closest_slot, level_t begin_level, level_t end_level, context_t& context) const noexcept {
@@ -3208,7 +4127,7 @@ class index_gt {
             bool changed;
             do {
                 changed = false;
-                node_lock_t closest_lock = node_lock_(closest_slot);
+                node_lock_t closest_lock = node_lock_<inserting_ak>(closest_slot, context);
                 neighbors_ref_t closest_neighbors = neighbors_non_base_(node_at_(closest_slot), level);
 
                 // Optional prefetching
@@ -3275,7 +4194,7 @@ class index_gt {
             if (new_slot == candidate_slot)
                 continue;
             node_t candidate_ref = node_at_(candidate_slot);
-            node_lock_t candidate_lock = node_lock_(candidate_slot);
+            node_lock_t candidate_lock = node_lock_<true>(candidate_slot, context);
             neighbors_ref_t candidate_neighbors = neighbors_(candidate_ref, level);
 
             // Optional prefetching
@@ -3366,8 +4285,10 @@ class index_gt {
                     // This can substantially grow our priority queue:
                     next.insert({-successor_dist, successor_slot});
                     if (!is_dummy<predicate_at>())
-                        if (!predicate(member_cref_t{node_at_(successor_slot).ckey(), successor_slot}))
+                        if (!predicate(member_cref_t{node_at_(successor_slot).ckey(), successor_slot})) {
+                            context.rejected_members_count++;
                             continue;
+                        }
 
                     // This will automatically evict poor matches:
                     top.insert({successor_dist, successor_slot}, top_limit);
@@ -3392,8 +4313,10 @@ class index_gt {
         top.reserve(count);
         for (std::size_t i = 0; i != size(); ++i) {
             if (!is_dummy<predicate_at>())
-                if (!predicate(at(i)))
+                if (!predicate(at(i))) {
+                    context.rejected_members_count++;
                     continue;
+                }
 
             distance_t distance = context.measure(query, citerator_at(i), metric);
             top.insert(candidate_t{distance, static_cast<compressed_slot_t>(i)}, count);
@@ -3410,6 +4333,7 @@ class index_gt {
         metric_at&& metric,    //
         std::size_t needed, top_candidates_t& top, context_t& context) const noexcept {
 
+        usearch_profile_m(refining, context.build_stats.refine_cycles);
         top.sort_ascending();
         candidate_t* top_data = top.data();
         std::size_t const top_count = top.size();
@@ -3445,12 +4369,34 @@ class index_gt {
     }
 };
 
+/**
+ *  @brief  Statistics of a single round of `join` over the free men.
+ *          Dividing the proposals by the elapsed time gives the throughput of the round.
+ */
+struct join_round_t {
+    /// @brief Number of proposals, or searches, issued in this round.
+    std::size_t proposals{};
+    /// @brief Number of men, that got engaged in this round, including the ones breaking up other couples.
+    std::size_t engagements{};
+    /// @brief Wall-clock duration of the round, in nanoseconds.
+    std::uint64_t elapsed_ns{};
+};
+
+/// @brief Number of the first `join` rounds, reported one by one. The rest are summed into the last entry.
+constexpr std::size_t join_tracked_rounds() { return 16; }
+
 struct join_result_t {
     error_t error{};
     std::size_t intersection_size{};
     std::size_t engagements{};
     std::size_t visited_members{};
     std::size_t computed_distances{};
+    /// @brief Number of rounds over the shrinking list of free men.
+    std::size_t rounds{};
+    /// @brief Number of proposals, or searches, issued by all men.
+    std::size_t proposals{};
+    /// @brief Statistics of the first `(std::min)(rounds, join_tracked_rounds())` rounds.
+    join_round_t rounds_stats[join_tracked_rounds()]{};
 
     explicit operator bool() const noexcept { return !error; }
     join_result_t failed(error_t message) noexcept {
@@ -3532,19 +4478,19 @@ static join_result_t join(               //
     using compressed_slot_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<compressed_slot_t>;
     using proposals_count_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<proposals_count_t>;
 
-    // Create an atomic queue, as a ring structure, from/to which
-    // free men will be added/pulled.
-    std::mutex free_men_mutex{};
-    ring_gt<compressed_slot_t, compressed_slot_allocator_t> free_men;
-    free_men.reserve(men.size());
-    for (std::size_t i = 0; i != men.size(); ++i)
-        free_men.push(static_cast<compressed_slot_t>(i));
+    // Free men are processed in rounds. Every round consumes one array of free men,
+    // handing out batches through an atomic cursor, and appends the rejected or
+    // dumped men into the next array through an atomic tail. A man is free at most
+    // once per round, so both arrays are bounded by the number of men, and no mutex
+    // is needed to move them around.
+    buffer_gt<compressed_slot_t, compressed_slot_allocator_t> free_men(men.size());
+    buffer_gt<compressed_slot_t, compressed_slot_allocator_t> next_free_men(men.size());
 
     // We are gonna need some temporary memory.
     buffer_gt<proposals_count_t, proposals_count_allocator_t> proposal_counts(men.size());
     buffer_gt<compressed_slot_t, compressed_slot_allocator_t> man_to_woman_slots(men.size());
     buffer_gt<compressed_slot_t, compressed_slot_allocator_t> woman_to_man_slots(women.size());
-    if (!proposal_counts || !man_to_woman_slots || !woman_to_man_slots)
+    if (!free_men || !next_free_men || !proposal_counts || !man_to_woman_slots || !woman_to_man_slots)
         return result.failed("Can't temporary mappings");
 
     compressed_slot_t missing_slot;
@@ -3552,95 +4498,135 @@ static join_result_t join(               //
     std::memset((void*)man_to_woman_slots.data(), 0xFF, sizeof(compressed_slot_t) * men.size());
     std::memset((void*)woman_to_man_slots.data(), 0xFF, sizeof(compressed_slot_t) * women.size());
     std::memset(proposal_counts.data(), 0, sizeof(proposals_count_t) * men.size());
+    for (std::size_t i = 0; i != men.size(); ++i)
+        free_men[i] = static_cast<compressed_slot_t>(i);
 
-    // Define locks, to limit concurrent accesses to `man_to_woman_slots` and `woman_to_man_slots`.
-    bitset_t men_locks(men.size()), women_locks(women.size());
-    if (!men_locks || !women_locks)
+    // Define locks, to limit concurrent accesses to `woman_to_man_slots`.
+    // The `man_to_woman_slots` entries are only written by the thread owning the free man,
+    // or by the thread holding the lock of his current fiancée, which can't happen concurrently.
+    bitset_t women_locks(women.size());
+    if (!women_locks)
         return result.failed("Can't allocate locks");
 
-    std::atomic<std::size_t> rounds{0};
-    std::atomic<std::size_t> engagements{0};
+    if (config.batch_size == 0)
+        config.batch_size = default_join_batch_size();
+
+    std::size_t free_men_count = men.size();
+    std::size_t rounds = 0;
+    std::size_t proposals = 0;
+    std::size_t engagements = 0;
     std::atomic<std::size_t> computed_distances{0};
     std::atomic<std::size_t> visited_members{0};
     std::atomic<char const*> atomic_error{nullptr};
 
-    // Concurrently process all the men
-    executor.parallel([&](std::size_t thread_idx) {
-        index_search_config_t search_config;
-        search_config.expansion = config.expansion;
-        search_config.exact = config.exact;
-        search_config.thread = thread_idx;
-        compressed_slot_t free_man_slot;
-
-        // While there exist a free man who still has a woman to propose to.
-        while (!atomic_error.load(std::memory_order_relaxed)) {
-            std::size_t passed_rounds = 0;
-            std::size_t total_rounds = 0;
-            {
-                std::unique_lock<std::mutex> pop_lock(free_men_mutex);
-                if (!free_men.try_pop(free_man_slot))
+    // While there exist a free man who still has a woman to propose to.
+    while (free_men_count && !atomic_error.load(std::memory_order_relaxed)) {
+        std::atomic<std::size_t> round_cursor{0};
+        std::atomic<std::size_t> round_proposals{0};
+        std::atomic<std::size_t> round_engagements{0};
+        std::atomic<std::size_t> next_free_men_count{0};
+        auto round_start = std::chrono::steady_clock::now();
+
+        // Concurrently process batches of men in this round
+        executor.parallel([&](std::size_t thread_idx) {
+            index_search_config_t search_config;
+            search_config.expansion = config.expansion;
+            search_config.exact = config.exact;
+            search_config.thread = thread_idx;
+
+            while (!atomic_error.load(std::memory_order_relaxed)) {
+                std::size_t batch_begin = round_cursor.fetch_add(config.batch_size, std::memory_order_relaxed);
+                if (batch_begin >= free_men_count)
                     // Primary exit path, we have exhausted the list of candidates
                     break;
-                passed_rounds = ++rounds;
-                total_rounds = passed_rounds + free_men.size();
-            }
-            progress(passed_rounds, total_rounds);
-            while (men_locks.atomic_set(free_man_slot))
-                ;
-
-            proposals_count_t& free_man_proposals = proposal_counts[free_man_slot];
-            if (free_man_proposals >= config.max_proposals)
-                continue;
+                std::size_t batch_end = (std::min)(free_men_count, batch_begin + config.batch_size);
+
+                // Accumulate the statistics locally, to avoid contention on shared counters
+                std::size_t batch_visited_members = 0;
+                std::size_t batch_computed_distances = 0;
+                std::size_t batch_engagements = 0;
+                std::size_t batch_proposals = 0;
+
+                for (std::size_t free_man_idx = batch_begin; free_man_idx != batch_end; ++free_man_idx) {
+                    compressed_slot_t free_man_slot = free_men[free_man_idx];
+                    proposals_count_t& free_man_proposals = proposal_counts[free_man_slot];
+                    if (free_man_proposals >= config.max_proposals)
+                        // This man has exhausted his options and stays single
+                        continue;
+
+                    // Find the closest woman, to whom this man hasn't proposed yet.
+                    ++free_man_proposals;
+                    ++batch_proposals;
+                    auto candidates =
+                        women.search(men_values[free_man_slot], free_man_proposals, women_metric, search_config);
+                    batch_visited_members += candidates.visited_members;
+                    batch_computed_distances += candidates.computed_distances;
+                    if (!candidates) {
+                        atomic_error = candidates.error.release();
+                        break;
+                    }
 
-            // Find the closest woman, to whom this man hasn't proposed yet.
-            ++free_man_proposals;
-            auto candidates = women.search(men_values[free_man_slot], free_man_proposals, women_metric, search_config);
-            visited_members += candidates.visited_members;
-            computed_distances += candidates.computed_distances;
-            if (!candidates) {
-                atomic_error = candidates.error.release();
-                break;
-            }
+                    auto match = candidates.back();
+                    auto woman = match.member;
+                    while (women_locks.atomic_set(woman.slot))
+                        ;
 
-            auto match = candidates.back();
-            auto woman = match.member;
-            while (women_locks.atomic_set(woman.slot))
-                ;
+                    compressed_slot_t husband_slot = woman_to_man_slots[woman.slot];
+                    compressed_slot_t rejected_slot = free_man_slot;
+                    bool woman_is_free = husband_slot == missing_slot;
+                    if (woman_is_free) {
+                        // Engagement
+                        man_to_woman_slots[free_man_slot] = woman.slot;
+                        woman_to_man_slots[woman.slot] = free_man_slot;
+                        rejected_slot = missing_slot;
+                        batch_engagements++;
+                    } else {
+                        distance_t distance_from_husband =
+                            women_metric(women_values[woman.slot], men_values[husband_slot]);
+                        distance_t distance_from_candidate = match.distance;
+                        if (distance_from_husband > distance_from_candidate) {
+                            // Break-up
+                            man_to_woman_slots[husband_slot] = missing_slot;
+
+                            // New Engagement
+                            man_to_woman_slots[free_man_slot] = woman.slot;
+                            woman_to_man_slots[woman.slot] = free_man_slot;
+                            rejected_slot = husband_slot;
+                            batch_engagements++;
+                        }
+                    }
+                    women_locks.atomic_reset(woman.slot);
 
-            compressed_slot_t husband_slot = woman_to_man_slots[woman.slot];
-            bool woman_is_free = husband_slot == missing_slot;
-            if (woman_is_free) {
-                // Engagement
-                man_to_woman_slots[free_man_slot] = woman.slot;
-                woman_to_man_slots[woman.slot] = free_man_slot;
-                engagements++;
-            } else {
-                distance_t distance_from_husband = women_metric(women_values[woman.slot], men_values[husband_slot]);
-                distance_t distance_from_candidate = match.distance;
-                if (distance_from_husband > distance_from_candidate) {
-                    // Break-up
-                    while (men_locks.atomic_set(husband_slot))
-                        ;
-                    man_to_woman_slots[husband_slot] = missing_slot;
-                    men_locks.atomic_reset(husband_slot);
-
-                    // New Engagement
-                    man_to_woman_slots[free_man_slot] = woman.slot;
-                    woman_to_man_slots[woman.slot] = free_man_slot;
-                    engagements++;
-
-                    std::unique_lock<std::mutex> push_lock(free_men_mutex);
-                    free_men.push(husband_slot);
-                } else {
-                    std::unique_lock<std::mutex> push_lock(free_men_mutex);
-                    free_men.push(free_man_slot);
+                    if (rejected_slot != missing_slot)
+                        next_free_men[next_free_men_count.fetch_add(1, std::memory_order_relaxed)] = rejected_slot;
                 }
+
+                visited_members += batch_visited_members;
+                computed_distances += batch_computed_distances;
+                round_engagements += batch_engagements;
+                std::size_t passed_proposals = round_proposals += batch_proposals;
+
+                // Only the first thread reports progress, so the callback doesn't have to be thread-safe
+                if (thread_idx == 0)
+                    progress(proposals + passed_proposals,
+                             proposals + passed_proposals + (free_men_count - (std::min)(free_men_count, batch_end)) +
+                                 next_free_men_count.load(std::memory_order_relaxed));
             }
+        });
 
-            men_locks.atomic_reset(free_man_slot);
-            women_locks.atomic_reset(woman.slot);
-        }
-    });
+        // The parallel region acts as a barrier, so the next round can reuse the arrays.
+        join_round_t& round = result.rounds_stats[(std::min)(rounds, join_tracked_rounds() - 1)];
+        round.proposals += round_proposals.load();
+        round.engagements += round_engagements.load();
+        round.elapsed_ns += static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - round_start)
+                .count());
+        proposals += round_proposals.load();
+        engagements += round_engagements.load();
+        free_men_count = next_free_men_count.load();
+        std::swap(free_men, next_free_men);
+        ++rounds;
+    }
 
     if (atomic_error)
         return result.failed(atomic_error.load());
@@ -3660,6 +4646,8 @@ static join_result_t join(               //
 
     // Export stats
     result.engagements = engagements;
+    result.rounds = rounds;
+    result.proposals = proposals;
     result.intersection_size = intersection_size;
     result.computed_distances = computed_distances;
     result.visited_members = visited_members;
@@ -1,12 +1,15 @@
 #pragma once
 #include <stdlib.h> // `aligned_alloc`
 
-#include <functional>    // `std::function`
-#include <numeric>       // `std::iota`
-#include <shared_mutex>  // `std::shared_mutex`
-#include <thread>        // `std::thread`
-#include <unordered_set> // `std::unordered_multiset`
-#include <vector>        // `std::vector`
+#include <chrono>             // `std::chrono::steady_clock`
+#include <condition_variable> // `std::condition_variable`
+#include <functional>         // `std::function`
+#include <numeric>            // `std::iota`
+#include <random>             // `std::mt19937_64`
+#include <shared_mutex>       // `std::shared_mutex`
+#include <thread>             // `std::thread`
+#include <unordered_set>      // `std::unordered_multiset`
+#include <vector>             // `std::vector`
 
 #include <usearch/index.hpp>
 #include <usearch/index_plugins.hpp>
@@ -93,6 +96,10 @@ struct index_dense_config_t : public index_config_t {
     bool exclude_vectors = false;
     bool multi = false;
 
+    /// @brief Number of recent search results to cache, skipping the traversal for repeated queries.
+    /// Zero disables the cache. Any `add`, `remove`, or `rename` invalidates all the cached results.
+    std::size_t cache_capacity = 0;
+
     index_dense_config_t(index_config_t base) noexcept : index_config_t(base) {}
 
     index_dense_config_t(                                  //
@@ -113,6 +120,37 @@ struct index_dense_clustering_config_t {
     } mode = merge_smallest_k;
 };
 
+struct index_dense_kmeans_config_t {
+    /// @brief Number of centroids to produce.
+    std::size_t clusters = 0;
+    /// @brief Upper bound on the number of Lloyd or Mini-Batch iterations.
+    std::size_t max_iterations = 16;
+    /// @brief Number of members sampled per iteration. Zero will run full-batch Lloyd iterations.
+    std::size_t batch_size = 0;
+    /// @brief Full-batch iterations stop, once this share of members or less changes clusters.
+    double tolerance = 1e-3;
+    /// @brief Penalizes assignments to oversized clusters, to balance their sizes. Zero disables it.
+    double balance = 0;
+    /// @brief Seed for the random sampling of Mini-Batches.
+    std::uint64_t seed = 42;
+};
+
+struct index_dense_tune_config_t {
+    /// @brief Share of the exact nearest neighbors, expected among the approximate ones.
+    double target_recall = 0.95;
+    /// @brief Number of neighbors searched per query, defining the `recall@wanted`.
+    std::size_t wanted = 10;
+    /// @brief Upper bound for the explored `expansion_search` values.
+    std::size_t max_expansion = 4096;
+};
+
+/// @brief One measurement of the `index_dense_gt::tune` sweep.
+struct index_dense_tune_point_t {
+    std::size_t expansion = 0;
+    double recall = 0;
+    double queries_per_second = 0;
+};
+
 struct index_dense_serialization_config_t {
     bool exclude_vectors = false;
     bool use_64_bit_dimensions = false;
@@ -219,6 +257,213 @@ inline index_dense_metadata_result_t index_dense_metadata(char const* file_path)
     return result.failed("Not a dense USearch index!");
 }
 
+/**
+ *  @brief  Memory consumed by an `index_dense_gt`, split by component, to plan the capacity of hosts.
+ *          Memory-mapped files, opened with `view`, are backed by the page cache and not counted.
+ */
+struct index_dense_memory_stats_t {
+    /// @brief Keys, levels and neighbors lists of the graph nodes.
+    std::size_t graph = 0;
+    /// @brief Pointers to the nodes and vectors and their spin-locks, proportional to the capacity.
+    std::size_t slots = 0;
+    /// @brief Copies of the vectors, owned by the index.
+    std::size_t vectors = 0;
+    /// @brief Hash-table from keys to slots, including the per-entry heap allocations, and the free-list.
+    std::size_t keys = 0;
+    /// @brief Thread-local search and casting buffers.
+    std::size_t contexts = 0;
+    std::size_t cache = 0;
+    /// @brief Alignment padding and abandoned tails of the arenas, holding the nodes and vectors.
+    std::size_t arenas_wasted = 0;
+    /// @brief Unused remainder of the latest arenas, to be occupied by the following insertions.
+    std::size_t arenas_reserved = 0;
+
+    std::size_t total() const noexcept {
+        return graph + slots + vectors + keys + contexts + cache + arenas_wasted + arenas_reserved;
+    }
+};
+
+struct search_cache_stats_t {
+    std::size_t capacity = 0;
+    std::size_t hits = 0;
+    std::size_t misses = 0;
+
+    double hit_rate() const noexcept { return hits + misses ? double(hits) / double(hits + misses) : 0.0; }
+};
+
+/**
+ *  @brief  Size-bounded concurrent cache of recent search results, in front of `index_dense_gt::search`.
+ *
+ *  Every entry is keyed by the hash of the (already casted) query bytes and the search parameters,
+ *  and keeps a copy of the query, to tell apart colliding hashes. The cache is direct-mapped:
+ *  every query maps to exactly one entry, overwritten by the most recent result.
+ *
+ *  Entries are stamped with an epoch, bumped by every mutation of the index, invalidating all the
+ *  older results at once. Entries are guarded by spin-locks that are only ever tried, never waited on,
+ *  so a contended entry is a miss, rather than a stall in the hot path.
+ */
+template <typename compressed_slot_at, typename distance_at> //
+class search_cache_gt {
+  public:
+    using compressed_slot_t = compressed_slot_at;
+    using distance_t = distance_at;
+
+  private:
+    struct entry_t {
+        std::uint64_t hash = 0;
+        std::uint64_t epoch = 0;
+        std::size_t wanted = 0;
+        std::size_t expansion = 0;
+        bool exact = false;
+        std::vector<byte_t> query;
+        std::vector<compressed_slot_t> slots;
+        std::vector<distance_t> distances;
+    };
+
+    std::vector<entry_t> entries_;
+    mutable bitset_t locks_;
+
+    /// @brief Incremented on every mutation. Starts from one, so that empty entries are never valid.
+    std::atomic<std::uint64_t> epoch_{1};
+    mutable std::atomic<std::size_t> hits_{0};
+    mutable std::atomic<std::size_t> misses_{0};
+
+  public:
+    search_cache_gt() = default;
+    search_cache_gt(search_cache_gt&& other) noexcept { swap(other); }
+    search_cache_gt& operator=(search_cache_gt&& other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    void swap(search_cache_gt& other) noexcept {
+        std::swap(entries_, other.entries_);
+        std::swap(locks_, other.locks_);
+        epoch_ = other.epoch_.exchange(epoch_.load());
+        hits_ = other.hits_.exchange(hits_.load());
+        misses_ = other.misses_.exchange(misses_.load());
+    }
+
+    /**
+     *  @brief  Allocates the entries, dropping all the cached results. Zero ::capacity disables the cache.
+     *  @return `false` if the memory can't be allocated.
+     */
+    bool resize(std::size_t capacity) {
+        bitset_t new_locks(capacity);
+        if (capacity && !new_locks)
+            return false;
+        std::vector<entry_t> new_entries(capacity);
+        std::swap(entries_, new_entries);
+        std::swap(locks_, new_locks);
+        hits_ = 0, misses_ = 0;
+        return true;
+    }
+
+    explicit operator bool() const noexcept { return !entries_.empty(); }
+    std::uint64_t epoch() const noexcept { return epoch_.load(std::memory_order_acquire); }
+    void invalidate() noexcept {
+        if (!entries_.empty())
+            epoch_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    search_cache_stats_t stats() const noexcept {
+        search_cache_stats_t result;
+        result.capacity = entries_.size();
+        result.hits = hits_.load(std::memory_order_relaxed);
+        result.misses = misses_.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    std::size_t memory_usage() const noexcept {
+        std::size_t result = entries_.capacity() * sizeof(entry_t);
+        for (entry_t const& entry : entries_)
+            result += entry.query.capacity() + entry.slots.capacity() * sizeof(compressed_slot_t) +
+                      entry.distances.capacity() * sizeof(distance_t);
+        return result;
+    }
+
+    static std::uint64_t hash(                         //
+        byte_t const* query, std::size_t query_length, //
+        std::size_t wanted, std::size_t expansion, bool exact) noexcept {
+
+        std::uint64_t const multiplier = 0x9e3779b97f4a7c15ull;
+        std::uint64_t result = (wanted * multiplier) ^ (expansion << 1) ^ exact;
+        std::size_t i = 0;
+        for (; i + sizeof(std::uint64_t) <= query_length; i += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, query + i, sizeof(word));
+            result = (result ^ word) * multiplier;
+            result ^= result >> 29;
+        }
+        for (; i != query_length; ++i)
+            result = (result ^ query[i]) * multiplier;
+        return result ^ (result >> 32);
+    }
+
+    /**
+     *  @brief  Looks up the results of an identical query, cached at the given ::epoch.
+     *          On a hit, passes the cached `slots`, `distances` and their `count` to the ::callback,
+     *          while still holding the entry, so that it can copy them out.
+     *  @return `true` on a cache hit.
+     */
+    template <typename callback_at>
+    bool find(                                                             //
+        std::uint64_t hash, byte_t const* query, std::size_t query_length, //
+        std::size_t wanted, std::size_t expansion, bool exact,             //
+        std::uint64_t epoch, callback_at&& callback) const {
+
+        std::size_t entry_idx = static_cast<std::size_t>(hash % entries_.size());
+        if (locks_.atomic_set(entry_idx)) {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        entry_t const& entry = entries_[entry_idx];
+        bool hit = entry.epoch == epoch && entry.hash == hash && entry.wanted == wanted &&
+                   entry.expansion == expansion && entry.exact == exact && entry.query.size() == query_length &&
+                   std::memcmp(entry.query.data(), query, query_length) == 0;
+        if (hit)
+            callback(entry.slots.data(), entry.distances.data(), entry.slots.size());
+        locks_.atomic_reset(entry_idx);
+
+        (hit ? hits_ : misses_).fetch_add(1, std::memory_order_relaxed);
+        return hit;
+    }
+
+    /**
+     *  @brief  Caches the ::result of a search, started at the given ::epoch.
+     *          Skips the update, if the index has changed since, or if the entry is being accessed.
+     */
+    template <typename search_result_at>
+    void insert(                                                           //
+        std::uint64_t hash, byte_t const* query, std::size_t query_length, //
+        std::size_t wanted, std::size_t expansion, bool exact,             //
+        std::uint64_t epoch, search_result_at const& result) {
+
+        if (epoch != this->epoch())
+            return;
+        std::size_t entry_idx = static_cast<std::size_t>(hash % entries_.size());
+        if (locks_.atomic_set(entry_idx))
+            return;
+
+        entry_t& entry = entries_[entry_idx];
+        entry.hash = hash;
+        entry.epoch = epoch;
+        entry.wanted = wanted;
+        entry.expansion = expansion;
+        entry.exact = exact;
+        entry.query.assign(query, query + query_length);
+        entry.slots.resize(result.size());
+        entry.distances.resize(result.size());
+        for (std::size_t i = 0; i != result.size(); ++i) {
+            auto match = result[i];
+            entry.slots[i] = static_cast<compressed_slot_t>(match.member.slot);
+            entry.distances[i] = match.distance;
+        }
+        locks_.atomic_reset(entry_idx);
+    }
+};
+
 /**
  *  @brief  Oversimplified type-punned index for equidimensional vectors
  *          with automatic @b down-casting, hardware-specific @b SIMD metrics,
@@ -256,8 +501,8 @@ class index_dense_gt {
     using tape_allocator_t = memory_mapping_allocator_gt<64>;
 
   private:
-    /// @brief Schema: input buffer, bytes in input buffer, output buffer.
-    using cast_t = std::function<bool(byte_t const*, std::size_t, byte_t*)>;
+    using casts_t = casts_punned_t;
+    using cast_t = typename casts_t::cast_t;
     /// @brief Punned index.
     using index_t = index_gt<                 //
         distance_t, key_t, compressed_slot_t, //
@@ -293,19 +538,7 @@ class index_dense_gt {
     index_t* typed_ = nullptr;
 
     mutable std::vector<byte_t> cast_buffer_;
-    struct casts_t {
-        cast_t from_b1x8;
-        cast_t from_i8;
-        cast_t from_f16;
-        cast_t from_f32;
-        cast_t from_f64;
-
-        cast_t to_b1x8;
-        cast_t to_i8;
-        cast_t to_f16;
-        cast_t to_f32;
-        cast_t to_f64;
-    } casts_;
+    casts_t casts_;
 
     /// @brief An instance of a potentially stateful `metric_t` used to initialize copies and forks.
     metric_t metric_;
@@ -314,8 +547,20 @@ class index_dense_gt {
     /// @brief Allocator for the copied vectors, aligned to widest double-precision scalars.
     vectors_tape_allocator_t vectors_tape_allocator_;
 
+    using vectors_lookup_t =
+        segmented_buffer_gt<byte_t*, std::allocator<byte_t*>, sizeof(compressed_slot_t) * CHAR_BIT>;
+
     /// @brief For every managed `compressed_slot_t` stores a pointer to the allocated vector copy.
-    mutable std::vector<byte_t*> vectors_lookup_;
+    ///        Segmented, so that `reserve` doesn't move it under the concurrent searches.
+    mutable vectors_lookup_t vectors_lookup_;
+
+    using vectors_matrix_allocator_t = aligned_allocator_gt<byte_t, 64>;
+
+    /// @brief All the vectors read by `load`, kept in one row-major matrix, unlike the tape.
+    buffer_gt<byte_t, vectors_matrix_allocator_t> vectors_matrix_buffer_;
+
+    /// @brief Contiguous row-major matrix of vectors, read by `load` or mapped by `view`, addressed by slots.
+    span_gt<byte_t> vectors_matrix_;
 
     /// @brief Originally forms and array of integers [0, threads], marking all
     mutable std::vector<std::size_t> available_threads_;
@@ -323,6 +568,9 @@ class index_dense_gt {
     /// @brief Mutex, controlling concurrent access to `available_threads_`.
     mutable std::mutex available_threads_mutex_;
 
+    /// @brief Wakes up the callers waiting for a thread ID, when more callers than IDs are active.
+    mutable std::condition_variable available_threads_cv_;
+
     using shared_mutex_t = unfair_shared_mutex_t;
     using shared_lock_t = shared_lock_gt<shared_mutex_t>;
     using unique_lock_t = std::unique_lock<shared_mutex_t>;
@@ -348,8 +596,10 @@ class index_dense_gt {
         bool operator()(key_and_slot_t const& a, key_and_slot_t const& b) const noexcept { return a.key == b.key; }
     };
 
+    using slot_lookup_allocator_t = counting_allocator_gt<key_and_slot_t>;
+
     /// @brief Multi-Map from keys to IDs, and allocated vectors.
-    std::unordered_multiset<key_and_slot_t, lookup_key_hash_t, lookup_key_same_t> slot_lookup_;
+    std::unordered_multiset<key_and_slot_t, lookup_key_hash_t, lookup_key_same_t, slot_lookup_allocator_t> slot_lookup_;
 
     /// @brief Mutex, controlling concurrent access to `slot_lookup_`.
     mutable shared_mutex_t slot_lookup_mutex_;
@@ -363,11 +613,17 @@ class index_dense_gt {
     /// @brief A constant for the reserved key value, used to mark deleted entries.
     key_t free_key_ = default_free_value<key_t>();
 
+    using search_cache_t = search_cache_gt<compressed_slot_t, distance_t>;
+    /// @brief Optional cache of recent search results, invalidated by every mutation.
+    mutable search_cache_t cache_;
+
   public:
     using search_result_t = typename index_t::search_result_t;
     using cluster_result_t = typename index_t::cluster_result_t;
     using add_result_t = typename index_t::add_result_t;
     using stats_t = typename index_t::stats_t;
+    using health_t = typename index_t::health_t;
+    using repair_result_t = typename index_t::repair_result_t;
     using match_t = typename index_t::match_t;
 
     index_dense_gt() = default;
@@ -381,11 +637,14 @@ class index_dense_gt {
 
           vectors_tape_allocator_(std::move(other.vectors_tape_allocator_)), //
           vectors_lookup_(std::move(other.vectors_lookup_)),                 //
+          vectors_matrix_buffer_(std::move(other.vectors_matrix_buffer_)),   //
+          vectors_matrix_(exchange(other.vectors_matrix_, {})),              //
 
           available_threads_(std::move(other.available_threads_)), //
           slot_lookup_(std::move(other.slot_lookup_)),             //
           free_keys_(std::move(other.free_keys_)),                 //
-          free_key_(std::move(other.free_key_)) {}                 //
+          free_key_(std::move(other.free_key_)),                   //
+          cache_(std::move(other.cache_)) {}                       //
 
     index_dense_gt& operator=(index_dense_gt&& other) {
         swap(other);
@@ -406,11 +665,14 @@ class index_dense_gt {
 
         std::swap(vectors_tape_allocator_, other.vectors_tape_allocator_);
         std::swap(vectors_lookup_, other.vectors_lookup_);
+        std::swap(vectors_matrix_buffer_, other.vectors_matrix_buffer_);
+        std::swap(vectors_matrix_, other.vectors_matrix_);
 
         std::swap(available_threads_, other.available_threads_);
         std::swap(slot_lookup_, other.slot_lookup_);
         std::swap(free_keys_, other.free_keys_);
         std::swap(free_key_, other.free_key_);
+        cache_.swap(other.cache_);
     }
 
     ~index_dense_gt() {
@@ -438,9 +700,11 @@ class index_dense_gt {
         index_dense_gt result;
         result.config_ = config;
         result.cast_buffer_.resize(hardware_threads * metric.bytes_per_vector());
-        result.casts_ = make_casts_(scalar_kind);
+        result.casts_ = casts_t::make(scalar_kind);
         result.metric_ = metric;
         result.free_key_ = free_key;
+        if (!result.cache_.resize(config.cache_capacity))
+            return {};
 
         // Fill the thread IDs.
         result.available_threads_.resize(hardware_threads);
@@ -506,17 +770,80 @@ class index_dense_gt {
     key_t const& free_key() const { return free_key_; }
 
     /**
-     *  @brief  A relatively accurate lower bound on the amount of memory consumed by the system.
-     *          In practice it's error will be below 10%.
-     *
+     *  @brief  Reports the capacity and the hit-rate of the search results cache.
+     *          The counters are reset every time the cache is resized.
+     */
+    search_cache_stats_t cache_stats() const noexcept { return cache_.stats(); }
+
+    /**
+     *  @brief  Resizes the search results cache, dropping all the cached results. Zero disables it.
+     *          Not thread-safe, can't be called concurrently with `search`.
+     */
+    bool change_cache_capacity(std::size_t capacity) {
+        if (!cache_.resize(capacity))
+            return false;
+        config_.cache_capacity = capacity;
+        return true;
+    }
+
+    /**
+     *  @brief  Picks up to ::count diverse members of the upper graph levels as entry points,
+     *          starting every following search from the closest of them. Zero disables them.
+     *          Not thread-safe, can't be called concurrently with `add` or `search`.
+     */
+    bool refresh_entry_points(std::size_t count) {
+        if (!typed_->refresh_entry_points(count, metric_proxy_t{*this}))
+            return false;
+        cache_.invalidate();
+        return true;
+    }
+
+    std::size_t entry_points() const noexcept { return typed_->entry_points(); }
+
+    /**
+     *  @brief  Enables the per-thread search counters, including the time spent casting the queries.
+     *          Disabled by default, to avoid even the minimal bookkeeping overhead.
+     */
+    void enable_search_stats(bool enabled = true) noexcept { typed_->enable_search_stats(enabled); }
+    bool search_stats_enabled() const noexcept { return typed_->search_stats_enabled(); }
+
+    /// @brief Aggregates the search counters of all threads. Cache hits are not counted.
+    index_search_stats_t search_stats() const noexcept { return typed_->search_stats(); }
+    void reset_search_stats() noexcept { typed_->reset_search_stats(); }
+
+    /// @brief Aggregates the per-phase timings of insertions, if compiled with `USEARCH_USE_PROFILING`.
+    index_build_stats_t build_stats() const noexcept { return typed_->build_stats(); }
+    void reset_build_stats() noexcept { typed_->reset_build_stats(); }
+
+    /**
+     *  @brief  The amount of memory consumed by the index, summing up all of the `memory_stats`.
      *  @see    `stream_length` for the length of the binary serialized representation.
      */
-    std::size_t memory_usage() const {
-        return                                          //
-            typed_->memory_usage(0) +                   //
-            typed_->tape_allocator().total_wasted() +   //
-            typed_->tape_allocator().total_reserved() + //
-            vectors_tape_allocator_.total_allocated();
+    std::size_t memory_usage() const { return memory_stats().total(); }
+
+    /**
+     *  @brief  Memory consumed by every component of the index, as requested from the allocators.
+     *          The per-allocation headers of `malloc` are not included.
+     */
+    index_dense_memory_stats_t memory_stats() const {
+        index_dense_memory_stats_t result;
+        typename index_t::memory_stats_t graph = typed_->memory_stats();
+        result.graph = graph.nodes;
+        result.slots = graph.slots + vectors_lookup_.memory_usage();
+        result.contexts = graph.contexts + cast_buffer_.capacity();
+        result.contexts += available_threads_.capacity() * sizeof(std::size_t);
+        result.cache = cache_.memory_usage();
+
+        // Both arenas also keep a small header in every mapped region, which we attribute to the payload
+        result.arenas_wasted = typed_->tape_allocator().total_wasted() + vectors_tape_allocator_.total_wasted();
+        result.arenas_reserved = typed_->tape_allocator().total_reserved() + vectors_tape_allocator_.total_reserved();
+        if (vectors_tape_allocator_.total_allocated())
+            result.vectors = vectors_tape_allocator_.total_allocated() - vectors_tape_allocator_.total_wasted() -
+                             vectors_tape_allocator_.total_reserved();
+        result.vectors += vectors_matrix_buffer_.size();
+        result.keys = slot_lookup_.get_allocator().total_allocated();
+        result.keys += free_keys_.capacity() * sizeof(compressed_slot_t);
+        return result;
     }
 
     static constexpr std::size_t any_thread() { return std::numeric_limits<std::size_t>::max(); }
@@ -659,17 +986,49 @@ class index_dense_gt {
 
     /**
      *  @brief Reserves memory for the index and the keyed lookup.
+     *         Growing the number of members may run concurrently with `add` and `search`.
      *  @return `true` if the memory reservation was successful, `false` otherwise.
      */
     bool reserve(index_limits_t limits) {
         {
             unique_lock_t lock(slot_lookup_mutex_);
             slot_lookup_.reserve(limits.members);
-            vectors_lookup_.resize(limits.members);
+            if (!vectors_lookup_.reserve(limits.members))
+                return false;
         }
         return typed_->reserve(limits);
     }
 
+    /**
+     *  @brief Leases several thread IDs at once, for a batch spread over an external thread-pool.
+     *         Waits until all of them are free, so concurrent batches never hold partial leases.
+     *  @param[out] thread_ids Buffer for `count` distinct IDs, to be passed as `thread` to `add` and `search`.
+     *  @return `false` if the pool, sized to the hardware concurrency, has fewer than `count` IDs.
+     */
+    bool lease_threads(std::size_t* thread_ids, std::size_t count) const {
+        if (count > std::thread::hardware_concurrency())
+            return false;
+
+        std::unique_lock<std::mutex> lock(available_threads_mutex_);
+        available_threads_cv_.wait(lock, [this, count] { return available_threads_.size() >= count; });
+        for (std::size_t i = 0; i != count; ++i) {
+            thread_ids[i] = available_threads_.back();
+            available_threads_.pop_back();
+        }
+        return true;
+    }
+
+    /**
+     *  @brief Returns the thread IDs, leased with `lease_threads`, to the pool.
+     */
+    void release_threads(std::size_t const* thread_ids, std::size_t count) const {
+        {
+            std::unique_lock<std::mutex> lock(available_threads_mutex_);
+            available_threads_.insert(available_threads_.end(), thread_ids, thread_ids + count);
+        }
+        available_threads_cv_.notify_all();
+    }
+
     /**
      *  @brief Erases all the vectors from the index.
      *
@@ -682,9 +1041,11 @@ class index_dense_gt {
         std::unique_lock<std::mutex> free_lock(free_keys_mutex_);
         typed_->clear();
         slot_lookup_.clear();
-        vectors_lookup_.clear();
         free_keys_.clear();
         vectors_tape_allocator_.reset();
+        vectors_matrix_buffer_ = {};
+        vectors_matrix_ = {};
+        cache_.invalidate();
     }
 
     /**
@@ -701,13 +1062,17 @@ class index_dense_gt {
         std::unique_lock<std::mutex> available_threads_lock(available_threads_mutex_);
         typed_->reset();
         slot_lookup_.clear();
-        vectors_lookup_.clear();
+        vectors_lookup_.reset();
         free_keys_.clear();
         vectors_tape_allocator_.reset();
+        vectors_matrix_buffer_ = {};
+        vectors_matrix_ = {};
 
         // Reset the thread IDs.
         available_threads_.resize(std::thread::hardware_concurrency());
         std::iota(available_threads_.begin(), available_threads_.end(), 0ul);
+        available_threads_cv_.notify_all();
+        cache_.invalidate();
     }
 
     /**
@@ -824,6 +1189,10 @@ class index_dense_gt {
         if (!result)
             return result;
 
+        usearch_trace_m(load__start, this);
+        vectors_matrix_buffer_ = {};
+        vectors_matrix_ = {};
+
         std::uint64_t matrix_rows = 0;
         std::uint64_t matrix_cols = 0;
 
@@ -845,15 +1214,19 @@ class index_dense_gt {
                 matrix_rows = dimensions[0];
                 matrix_cols = dimensions[1];
             }
-            // Load the vectors one after another
-            vectors_lookup_.resize(matrix_rows);
-            for (std::uint64_t slot = 0; slot != matrix_rows; ++slot) {
-                byte_t* vector = vectors_tape_allocator_.allocate(matrix_cols);
-                result = file.read(vector, matrix_cols);
-                if (!result)
-                    return result;
-                vectors_lookup_[slot] = vector;
-            }
+            // Load all the vectors with a single read, keeping them contiguous
+            std::size_t const matrix_bytes = static_cast<std::size_t>(matrix_rows * matrix_cols);
+            buffer_gt<byte_t, vectors_matrix_allocator_t> matrix_buffer(matrix_bytes);
+            if (!vectors_lookup_.reserve(matrix_rows) || (matrix_bytes && !matrix_buffer))
+                return result.failed("Out of memory!");
+            result = file.read(matrix_buffer.data(), matrix_bytes);
+            if (!result)
+                return result;
+            for (std::uint64_t slot = 0; slot != matrix_rows; ++slot)
+                vectors_lookup_[slot] = matrix_buffer.data() + matrix_cols * slot;
+            vectors_matrix_ = {matrix_buffer.data(), matrix_bytes};
+            vectors_matrix_buffer_ = std::move(matrix_buffer);
+            usearch_trace_m(load__vectors, this, matrix_rows, matrix_cols);
         }
 
         // Load metadata and choose the right metric
@@ -887,8 +1260,11 @@ class index_dense_gt {
             return result;
         if (typed_->size() != static_cast<std::size_t>(matrix_rows))
             return result.failed("Index size and the number of vectors doesn't match");
+        usearch_trace_m(load__graph, this, typed_->size());
 
         reindex_keys_();
+        cache_.invalidate();
+        usearch_trace_m(load__end, this, typed_->size());
         return result;
     }
 
@@ -904,6 +1280,10 @@ class index_dense_gt {
         if (!result)
             return result;
 
+        usearch_trace_m(view__start, this);
+        vectors_matrix_buffer_ = {};
+        vectors_matrix_ = {};
+
         std::uint64_t matrix_rows = 0;
         std::uint64_t matrix_cols = 0;
         span_punned_t vectors_buffer;
@@ -965,14 +1345,20 @@ class index_dense_gt {
             return result;
         if (typed_->size() != static_cast<std::size_t>(matrix_rows))
             return result.failed("Index size and the number of vectors doesn't match");
+        usearch_trace_m(view__graph, this, typed_->size());
 
         // Address the vectors
-        vectors_lookup_.resize(matrix_rows);
-        if (!config.exclude_vectors)
+        if (!vectors_lookup_.reserve(matrix_rows))
+            return result.failed("Out of memory!");
+        if (!config.exclude_vectors) {
             for (std::uint64_t slot = 0; slot != matrix_rows; ++slot)
                 vectors_lookup_[slot] = (byte_t*)vectors_buffer.data() + matrix_cols * slot;
+            vectors_matrix_ = {(byte_t*)vectors_buffer.data(), vectors_buffer.size()};
+        }
 
         reindex_keys_();
+        cache_.invalidate();
+        usearch_trace_m(view__end, this, typed_->size());
         return result;
     }
 
@@ -994,6 +1380,30 @@ class index_dense_gt {
         return slot_lookup_.count(key_and_slot_t::any_slot(key));
     }
 
+    /**
+     *  @brief Finds the slot of a vector with specified key, which is also its row in `vectors_matrix()`.
+     *         In multi-vector indexes, any one of the matching slots may be reported.
+     *  @return `true` if the key is present in the index, `false` otherwise.
+     */
+    bool slot_of(key_t key, compressed_slot_t& slot) const {
+        shared_lock_t lock(slot_lookup_mutex_);
+        auto it = slot_lookup_.find(key_and_slot_t::any_slot(key));
+        if (it == slot_lookup_.end())
+            return false;
+        slot = it->slot;
+        return true;
+    }
+
+    /**
+     *  @brief Exposes the vectors of a loaded or viewed index as a row-major matrix, without copying them.
+     *         Every row is `bytes_per_vector()` long, and its number matches the slot of the vector.
+     *         Vectors added after the `load` or `view` aren't covered, and `compact` discards the matrix.
+     *  @return Empty span, if the vectors aren't stored contiguously.
+     */
+    span_gt<byte_t const> vectors_matrix() const noexcept {
+        return {vectors_matrix_.data(), vectors_matrix_.size()};
+    }
+
     struct labeling_result_t {
         error_t error{};
         std::size_t completed{};
@@ -1038,6 +1448,7 @@ class index_dense_gt {
         }
         slot_lookup_.erase(matching_slots.first, matching_slots.second);
         result.completed = matching_count;
+        cache_.invalidate();
 
         return result;
     }
@@ -1083,6 +1494,7 @@ class index_dense_gt {
             result.completed += matching_count;
         }
 
+        cache_.invalidate();
         return result;
     }
 
@@ -1115,6 +1527,7 @@ class index_dense_gt {
             ++result.completed;
         }
 
+        cache_.invalidate();
         return result;
     }
 
@@ -1166,16 +1579,20 @@ class index_dense_gt {
             copy.free_keys_.push(free_keys_[i]);
 
         // Allocate buffers and move the vectors themselves
+        std::size_t const slots_count = typed_->size();
+        if (!copy.vectors_lookup_.reserve(typed_->capacity()))
+            return result.failed("Out of memory!");
         if (!config.force_vector_copy && copy.config_.exclude_vectors)
-            copy.vectors_lookup_ = vectors_lookup_;
+            for (std::size_t slot = 0; slot != slots_count; ++slot)
+                copy.vectors_lookup_[slot] = vectors_lookup_[slot];
         else {
-            copy.vectors_lookup_.resize(vectors_lookup_.size());
-            for (std::size_t slot = 0; slot != vectors_lookup_.size(); ++slot)
-                copy.vectors_lookup_[slot] = copy.vectors_tape_allocator_.allocate(copy.metric_.bytes_per_vector());
-            if (std::count(copy.vectors_lookup_.begin(), copy.vectors_lookup_.end(), nullptr))
-                return result.failed("Out of memory!");
-            for (std::size_t slot = 0; slot != vectors_lookup_.size(); ++slot)
-                std::memcpy(copy.vectors_lookup_[slot], vectors_lookup_[slot], metric_.bytes_per_vector());
+            for (std::size_t slot = 0; slot != slots_count; ++slot) {
+                byte_t* vector = copy.vectors_tape_allocator_.allocate(copy.metric_.bytes_per_vector());
+                if (!vector)
+                    return result.failed("Out of memory!");
+                std::memcpy(vector, vectors_lookup_[slot], metric_.bytes_per_vector());
+                copy.vectors_lookup_[slot] = vector;
+            }
         }
 
         copy.slot_lookup_ = slot_lookup_;
@@ -1238,6 +1655,7 @@ class index_dense_gt {
         };
         typed_->isolate(disallow, std::forward<executor_at>(executor), std::forward<progress_at>(progress));
         result.pruned_edges = pruned_edges;
+        cache_.invalidate();
         return result;
     }
 
@@ -1262,8 +1680,10 @@ class index_dense_gt {
     compaction_result_t compact(executor_at&& executor = executor_at{}, progress_at&& progress = progress_at{}) {
         compaction_result_t result;
 
-        std::vector<byte_t*> new_vectors_lookup(vectors_lookup_.size());
+        vectors_lookup_t new_vectors_lookup;
         vectors_tape_allocator_t new_vectors_allocator;
+        if (!new_vectors_lookup.reserve(typed_->capacity()))
+            return result.failed("Out of memory!");
 
         auto track_slot_change = [&](key_t, compressed_slot_t old_slot, compressed_slot_t new_slot) {
             byte_t* new_vector = new_vectors_allocator.allocate(metric_.bytes_per_vector());
@@ -1275,6 +1695,43 @@ class index_dense_gt {
                         std::forward<executor_at>(executor), std::forward<progress_at>(progress));
         vectors_lookup_ = std::move(new_vectors_lookup);
         vectors_tape_allocator_ = std::move(new_vectors_allocator);
+        vectors_matrix_buffer_ = {};
+        vectors_matrix_ = {};
+
+        // Members have moved to new slots, so the keys must be mapped again
+        reindex_keys_();
+        cache_.invalidate();
+        return result;
+    }
+
+    /**
+     *  @brief  Diagnoses the connectivity of one graph ::level, treating the removed entries as tombstones.
+     *          Many `banned_edges` suggest running `isolate` or `compact`, and `unreachable_nodes()`
+     *          on the base level suggest running `repair`.
+     */
+    template <typename executor_at = dummy_executor_t, typename progress_at = dummy_progress_t>
+    health_t health(std::size_t level, executor_at&& executor = executor_at{},
+                    progress_at&& progress = progress_at{}) const {
+        auto allow = [=](member_cref_t const& member) noexcept { return member.key != free_key_; };
+        return typed_->health(level, metric_proxy_t{*this}, allow, std::forward<executor_at>(executor),
+                              std::forward<progress_at>(progress));
+    }
+
+    /**
+     *  @brief  Reconnects the entries, that became unreachable from the entry point on the base level.
+     *          Not thread-safe, can't be called concurrently with `add`, `remove` or `search`.
+     */
+    template <typename progress_at = dummy_progress_t>
+    repair_result_t repair(progress_at&& progress = progress_at{}) {
+        thread_lock_t lock = thread_lock_(any_thread());
+        index_update_config_t update_config;
+        update_config.thread = lock.thread_id;
+        update_config.expansion = config_.expansion_add;
+
+        auto allow = [=](member_cref_t const& member) noexcept { return member.key != free_key_; };
+        repair_result_t result =
+            typed_->repair(metric_proxy_t{*this}, allow, update_config, std::forward<progress_at>(progress));
+        cache_.invalidate();
         return result;
     }
 
@@ -1492,7 +1949,545 @@ class index_dense_gt {
         return result;
     }
 
+    struct knn_graph_result_t {
+        error_t error{};
+        std::size_t members{};
+        std::size_t visited_members{};
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        knn_graph_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    /**
+     *  @brief  Exports the approximate k-Nearest-Neighbors graph of all the members.
+     *          Every search starts from the member itself, exploring its own neighbors list,
+     *          instead of descending through the upper levels from the entry point.
+     *
+     *  Every row of the output matrices corresponds to one present member, in the order of their slots,
+     *  and holds ::k entries. Missing neighbors are padded with `free_key()` and the maximum distance.
+     *
+     *  @param[in] k The number of neighbors to export per member, excluding the member itself.
+     *  @param[in] executor Thread-pool to execute the job in parallel.
+     *  @param[out] neighbors_keys Matrix of `size() x k` keys of the closest neighbors.
+     *  @param[out] neighbors_distances Matrix of `size() x k` distances to the closest neighbors.
+     *  @param[out] members_keys Optional array of `size()` keys, one per row of the output matrices.
+     *  @param[in] progress Callback to report the execution progress.
+     */
+    template <                                   //
+        typename executor_at = dummy_executor_t, //
+        typename progress_at = dummy_progress_t  //
+        >
+    knn_graph_result_t knn_graph(                //
+        std::size_t k,                           //
+        executor_at&& executor,                  //
+        key_t* neighbors_keys,                   //
+        distance_t* neighbors_distances,         //
+        key_t* members_keys = nullptr,           //
+        progress_at&& progress = progress_at{}) const {
+
+        knn_graph_result_t result;
+        if (!size())
+            return result;
+
+        // Skip the removed entries, so that the output matrices are dense
+        slots_buffer_t members_slots = present_slots_();
+        if (!members_slots)
+            return result.failed("Out of memory!");
+
+        std::size_t const members_count = members_slots.size();
+        std::atomic<std::size_t> processed{0};
+        std::atomic<std::size_t> visited_members{0};
+        std::atomic<std::size_t> computed_distances{0};
+        std::atomic<char const*> atomic_error{nullptr};
+
+        executor.dynamic(members_count, [&](std::size_t thread_idx, std::size_t row) {
+            std::size_t slot = members_slots[row];
+            key_t* row_keys = neighbors_keys + row * k;
+            distance_t* row_distances = neighbors_distances + row * k;
+            if (members_keys)
+                members_keys[row] = typed_->at(slot).key;
+
+            index_search_config_t search_config;
+            search_config.thread = thread_idx;
+            search_config.expansion = config_.expansion_search;
+
+            // Request one more match, as the member itself will likely be the closest
+            auto allow = [=](member_cref_t const& candidate) noexcept { return candidate.key != free_key_; };
+            search_result_t search_result = typed_->search_around( //
+                slot, vectors_lookup_[slot], k + 1, metric_proxy_t{*this}, search_config, allow);
+            if (!search_result) {
+                atomic_error = search_result.error.release();
+                return false;
+            }
+
+            std::size_t row_count = 0;
+            for (std::size_t i = 0; i != search_result.size() && row_count != k; ++i) {
+                match_t match = search_result[i];
+                if (static_cast<std::size_t>(match.member.slot) == slot || match.member.key == free_key_)
+                    continue;
+                row_keys[row_count] = match.member.key;
+                row_distances[row_count] = match.distance;
+                ++row_count;
+            }
+            for (; row_count != k; ++row_count) {
+                row_keys[row_count] = free_key_;
+                row_distances[row_count] = std::numeric_limits<distance_t>::max();
+            }
+
+            visited_members += search_result.visited_members;
+            computed_distances += search_result.computed_distances;
+            std::size_t processed_count = ++processed;
+            if (thread_idx == 0)
+                progress(processed_count, members_count);
+            return true;
+        });
+
+        if (atomic_error)
+            return result.failed(atomic_error.load());
+
+        result.members = members_count;
+        result.visited_members = visited_members;
+        result.computed_distances = computed_distances;
+        return result;
+    }
+
+    struct kmeans_result_t {
+        error_t error{};
+        std::size_t clusters{};
+        std::size_t iterations{};
+        std::size_t computed_distances{};
+        /// @brief Sum of distances from every member to its centroid, after the last assignment.
+        double inertia{};
+
+        explicit operator bool() const noexcept { return !error; }
+        kmeans_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    /**
+     *  @brief  Implements parallel k-Means clustering of all the present members,
+     *          seeded with the members of the highest graph level having enough nodes.
+     *
+     *  Depending on `index_dense_kmeans_config_t::batch_size` runs either classical Lloyd iterations,
+     *  or the Mini-Batch variant, updating centroids with per-cluster learning rates.
+     *  Centroids are accumulated in double-precision, but compared with members using the
+     *  original metric and scalar type of the index, benefiting from the same SIMD kernels.
+     *
+     *  Every entry of the optional members arrays corresponds to one present member, in the order
+     *  of their slots, matching the output of `knn_graph`. Together with ::centroids they form
+     *  an inverted-file partition of the index.
+     *
+     *  @param[in] config The number of clusters and the iterations schedule.
+     *  @param[out] centroids Matrix of `clusters x dimensions()` single-precision centroids.
+     *  @param[out] members_keys Optional array of `size()` keys.
+     *  @param[out] members_clusters Optional array of `size()` indexes of the assigned centroids.
+     *  @param[out] members_distances Optional array of `size()` distances to the assigned centroids.
+     *  @param[in] executor Thread-pool to execute the job in parallel.
+     *  @param[in] progress Callback to report the execution progress.
+     */
+    template <                                   //
+        typename executor_at = dummy_executor_t, //
+        typename progress_at = dummy_progress_t  //
+        >
+    kmeans_result_t kmeans(                      //
+        index_dense_kmeans_config_t config,      //
+        f32_t* centroids,                        //
+        key_t* members_keys = nullptr,           //
+        std::size_t* members_clusters = nullptr, //
+        distance_t* members_distances = nullptr, //
+        executor_at&& executor = executor_at{},  //
+        progress_at&& progress = progress_at{}) const {
+
+        kmeans_result_t result;
+        std::size_t const clusters_count = config.clusters;
+        std::size_t const dimensions = metric_.dimensions();
+        std::size_t const bytes_per_vector = metric_.bytes_per_vector();
+        if (!clusters_count)
+            return result.failed("Number of clusters must be positive");
+        if (size() < clusters_count)
+            return result.failed("Not enough members to seed the clusters");
+
+        using dynamic_allocator_traits_t = std::allocator_traits<dynamic_allocator_t>;
+        using sizes_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<std::size_t>;
+        using doubles_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<f64_t>;
+        using distances_allocator_t = typename dynamic_allocator_traits_t::template rebind_alloc<distance_t>;
+
+        slots_buffer_t members_slots = present_slots_();
+        std::size_t const members_count = members_slots.size();
+        std::size_t const batch_size = config.batch_size ? (std::min)(config.batch_size, members_count) : 0;
+
+        // Temporary memory is dominated by the `clusters x dimensions` matrices of the accumulators
+        buffer_gt<byte_t, dynamic_allocator_t> centroids_punned(clusters_count * bytes_per_vector);
+        buffer_gt<f64_t, doubles_allocator_t> centroids_sums(clusters_count * dimensions);
+        buffer_gt<f64_t, doubles_allocator_t> centroids_decoded(clusters_count * dimensions);
+        buffer_gt<std::size_t, sizes_allocator_t> clusters_sizes(clusters_count);
+        buffer_gt<std::size_t, sizes_allocator_t> clusters_offsets(clusters_count + 1);
+        buffer_gt<std::size_t, sizes_allocator_t> assignments(members_count);
+        buffer_gt<distance_t, distances_allocator_t> distances(members_count);
+        buffer_gt<std::size_t, sizes_allocator_t> sample(members_count);
+        buffer_gt<std::size_t, sizes_allocator_t> sample_by_cluster(members_count);
+        if (!members_slots || !centroids_punned || !centroids_sums || !centroids_decoded || !clusters_sizes ||
+            !clusters_offsets || !assignments || !distances || !sample || !sample_by_cluster)
+            return result.failed("Out of memory!");
+
+        // Seed with the members of the highest level, that has enough nodes to choose from.
+        // Those are sampled uniformly at random on insertion, and are already well spread.
+        std::size_t seed_level = max_level();
+        for (; seed_level; --seed_level) {
+            std::size_t level_members = 0;
+            for (std::size_t row = 0; row != members_count && level_members < clusters_count; ++row)
+                level_members += typed_->level_of(members_slots[row]) >= seed_level;
+            if (level_members >= clusters_count)
+                break;
+        }
+        std::size_t seeds_count = 0;
+        for (std::size_t row = 0; row != members_count; ++row)
+            seeds_count += typed_->level_of(members_slots[row]) >= seed_level;
+        for (std::size_t row = 0, seed_idx = 0, cluster_idx = 0; cluster_idx != clusters_count; ++row) {
+            std::size_t slot = members_slots[row];
+            if (typed_->level_of(slot) < seed_level)
+                continue;
+            // Take evenly spaced seeds, if there are more candidates than needed
+            if (seed_idx++ * clusters_count < cluster_idx * seeds_count)
+                continue;
+            f32_t* centroid = centroids + cluster_idx * dimensions;
+            if (!casts_.to_f32(vectors_lookup_[slot], dimensions, (byte_t*)centroid))
+                std::memcpy(centroid, vectors_lookup_[slot], bytes_per_vector);
+            ++cluster_idx;
+        }
+
+        std::fill_n(assignments.data(), members_count, clusters_count);
+        std::fill_n(clusters_sizes.data(), clusters_count, std::size_t(0));
+        std::atomic<std::size_t> computed_distances{0};
+        std::size_t processed_steps = 0;
+        std::size_t const total_steps = config.max_iterations + 1;
+        double mean_distance = 0;
+        bool const binary = metric_.scalar_kind() == scalar_kind_t::b1x8_k;
+
+        // Converts the single-precision centroids into the representation used by the metric.
+        auto punn_centroids = [&] {
+            executor.fixed(clusters_count, [&](std::size_t, std::size_t cluster_idx) {
+                f32_t* centroid = centroids + cluster_idx * dimensions;
+                byte_t* centroid_punned = centroids_punned.data() + cluster_idx * bytes_per_vector;
+                std::memset(centroid_punned, 0, bytes_per_vector);
+                if (binary)
+                    for (std::size_t i = 0; i != dimensions; ++i)
+                        centroid[i] = centroid[i] >= 0.5f ? 1.f : 0.f;
+                if (!casts_.from_f32((byte_t const*)centroid, dimensions, centroid_punned))
+                    std::memcpy(centroid_punned, centroid, bytes_per_vector);
+            });
+        };
+
+        // Maps every sampled member to the closest centroid, returning the number of reassigned members.
+        // With balancing enabled, the distances to larger clusters are penalized proportionally to their size.
+        auto assign = [&](std::size_t sample_size) {
+            std::atomic<std::size_t> reassigned{0};
+            std::size_t sizes_total = std::accumulate(clusters_sizes.begin(), clusters_sizes.end(), std::size_t(0));
+            double const penalty_scale =
+                sizes_total ? config.balance * mean_distance * clusters_count / sizes_total : 0.0;
+            executor.fixed(sample_size, [&](std::size_t, std::size_t task) {
+                std::size_t row = sample[task];
+                byte_t const* vector = vectors_lookup_[members_slots[row]];
+                std::size_t closest_idx = 0;
+                distance_t closest_distance = std::numeric_limits<distance_t>::max();
+                double closest_score = std::numeric_limits<double>::max();
+                for (std::size_t cluster_idx = 0; cluster_idx != clusters_count; ++cluster_idx) {
+                    distance_t distance = metric_(vector, centroids_punned.data() + cluster_idx * bytes_per_vector);
+                    double score = distance + penalty_scale * clusters_sizes[cluster_idx];
+                    if (score < closest_score)
+                        closest_idx = cluster_idx, closest_distance = distance, closest_score = score;
+                }
+                if (assignments[row] != closest_idx)
+                    ++reassigned;
+                assignments[row] = closest_idx;
+                distances[row] = closest_distance;
+            });
+            computed_distances += sample_size * clusters_count;
+
+            // Export the new sizes of clusters for the following balancing step.
+            // In the Mini-Batch mode those are the cumulative counts, maintained by `update`.
+            double distances_sum = 0;
+            for (std::size_t task = 0; task != sample_size; ++task)
+                distances_sum += std::abs(double(distances[sample[task]]));
+            mean_distance = distances_sum / sample_size;
+            if (!batch_size) {
+                std::fill_n(clusters_sizes.data(), clusters_count, std::size_t(0));
+                for (std::size_t row = 0; row != members_count; ++row)
+                    clusters_sizes[assignments[row]]++;
+            }
+            return reassigned.load();
+        };
+
+        // Groups the sampled members by their clusters, and moves the centroids towards them.
+        // Every centroid is updated by a single thread, so no synchronization is needed.
+        auto update = [&](std::size_t sample_size) {
+            std::fill_n(clusters_offsets.data(), clusters_count + 1, std::size_t(0));
+            for (std::size_t task = 0; task != sample_size; ++task)
+                clusters_offsets[assignments[sample[task]] + 1]++;
+            for (std::size_t cluster_idx = 0; cluster_idx != clusters_count; ++cluster_idx)
+                clusters_offsets[cluster_idx + 1] += clusters_offsets[cluster_idx];
+            for (std::size_t task = 0; task != sample_size; ++task) {
+                std::size_t row = sample[task];
+                sample_by_cluster[clusters_offsets[assignments[row]]++] = row;
+            }
+            for (std::size_t cluster_idx = clusters_count; cluster_idx; --cluster_idx)
+                clusters_offsets[cluster_idx] = clusters_offsets[cluster_idx - 1];
+            clusters_offsets[0] = 0;
+
+            executor.fixed(clusters_count, [&](std::size_t, std::size_t cluster_idx) {
+                std::size_t begin = clusters_offsets[cluster_idx], end = clusters_offsets[cluster_idx + 1];
+                if (begin == end)
+                    // Empty clusters keep their previous centroids
+                    return;
+
+                f32_t* centroid = centroids + cluster_idx * dimensions;
+                f64_t* sums = centroids_sums.data() + cluster_idx * dimensions;
+                f64_t* decoded = centroids_decoded.data() + cluster_idx * dimensions;
+                std::fill_n(sums, dimensions, f64_t(0));
+                for (std::size_t i = begin; i != end; ++i) {
+                    byte_t const* vector = vectors_lookup_[members_slots[sample_by_cluster[i]]];
+                    if (!casts_.to_f64(vector, dimensions, (byte_t*)decoded))
+                        std::memcpy(decoded, vector, bytes_per_vector);
+
+                    if (batch_size) {
+                        // Mini-Batch update with a per-center learning rate
+                        f64_t learning_rate = 1.0 / ++clusters_sizes[cluster_idx];
+                        for (std::size_t j = 0; j != dimensions; ++j)
+                            centroid[j] = f32_t(centroid[j] + learning_rate * (decoded[j] - centroid[j]));
+                    } else {
+                        for (std::size_t j = 0; j != dimensions; ++j)
+                            sums[j] += decoded[j];
+                    }
+                }
+                if (!batch_size)
+                    for (std::size_t j = 0; j != dimensions; ++j)
+                        centroid[j] = f32_t(sums[j] / (end - begin));
+            });
+            punn_centroids();
+        };
+
+        // Full-batch iterations continue until the assignments stabilize
+        std::iota(sample.data(), sample.data() + members_count, std::size_t(0));
+        punn_centroids();
+        std::size_t iterations = 0;
+        if (!batch_size) {
+            assign(members_count);
+            progress(++processed_steps, total_steps);
+            for (; iterations != config.max_iterations; ++iterations) {
+                update(members_count);
+                std::size_t reassigned = assign(members_count);
+                progress(++processed_steps, total_steps);
+                if (reassigned <= config.tolerance * members_count) {
+                    ++iterations;
+                    break;
+                }
+            }
+        }
+        // Mini-Batch iterations are always exhaustive, and are followed by a complete assignment
+        else {
+            std::mt19937_64 generator(config.seed);
+            std::uniform_int_distribution<std::size_t> distribution(0, members_count - 1);
+            for (; iterations != config.max_iterations; ++iterations) {
+                for (std::size_t task = 0; task != batch_size; ++task)
+                    sample[task] = distribution(generator);
+                // Deduplicate, so that every member is assigned by a single thread
+                std::sort(sample.data(), sample.data() + batch_size);
+                std::size_t sample_size = std::unique(sample.data(), sample.data() + batch_size) - sample.data();
+                assign(sample_size);
+                update(sample_size);
+                progress(++processed_steps, total_steps);
+            }
+            std::iota(sample.data(), sample.data() + members_count, std::size_t(0));
+            assign(members_count);
+        }
+        progress(total_steps, total_steps);
+
+        // Export the partitioning
+        double inertia = 0;
+        for (std::size_t row = 0; row != members_count; ++row) {
+            if (members_keys)
+                members_keys[row] = typed_->at(members_slots[row]).key;
+            if (members_clusters)
+                members_clusters[row] = assignments[row];
+            if (members_distances)
+                members_distances[row] = distances[row];
+            inertia += distances[row];
+        }
+
+        result.clusters = clusters_count;
+        result.iterations = iterations;
+        result.computed_distances = computed_distances;
+        result.inertia = inertia;
+        return result;
+    }
+
+    struct tune_result_t {
+        error_t error{};
+        /// @brief The cheapest `expansion_search` meeting the target, or the most accurate one explored.
+        std::size_t expansion{};
+        double recall{};
+        double queries_per_second{};
+        /// @brief Non-dominated measurements, sorted by increasing recall and decreasing throughput.
+        std::vector<index_dense_tune_point_t> pareto{};
+
+        explicit operator bool() const noexcept { return !error; }
+        tune_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+    /**
+     *  @brief  Tunes the `expansion_search` on the live index, to reach the target recall on the
+     *          sample ::queries as cheaply as possible, and applies it to the following searches.
+     *
+     *  Doubles the expansion, starting from `wanted`, until the target is met, and then binary-searches
+     *  the gap between the last two values. Every probe searches all the ::queries, measuring the recall
+     *  against the ::ground_truth and the throughput with the given ::executor. If the ground truth is
+     *  not provided, it is computed with exact search. The `connectivity` and `expansion_add` can only
+     *  be changed by rebuilding the index, and aren't explored.
+     *  Changes the `expansion_search`, so can't be called concurrently with `search`.
+     *
+     *  @param[in] queries Matrix of `queries_count x dimensions()` sample queries.
+     *  @param[in] queries_count Number of the sample queries.
+     *  @param[in] config The target recall and the bounds of the sweep.
+     *  @param[in] ground_truth Optional matrix of `queries_count x wanted` keys of the exact neighbors.
+     *  @param[in] executor Thread-pool to execute the searches in parallel.
+     */
+    template <typename scalar_at, typename executor_at = dummy_executor_t>
+    tune_result_t tune(                        //
+        scalar_at const* queries,              //
+        std::size_t queries_count,             //
+        index_dense_tune_config_t config = {}, //
+        key_t const* ground_truth = nullptr,   //
+        executor_at&& executor = executor_at{}) {
+
+        tune_result_t result;
+        std::size_t const wanted = config.wanted;
+        std::size_t const dimensions = metric_.dimensions();
+        if (!wanted || !queries_count)
+            return result.failed("Need at least one query and one wanted match");
+        if (!size())
+            return result.failed("Nothing to tune, the index is empty");
+
+        // Cached results would make the searches look free
+        cache_.invalidate();
+        std::size_t const initial_expansion = config_.expansion_search;
+        std::vector<key_t> found_keys(queries_count * wanted);
+        std::vector<std::size_t> found_counts(queries_count);
+        std::vector<key_t> exact_keys;
+        std::vector<std::size_t> exact_counts(queries_count, wanted);
+        std::atomic<char const*> atomic_error{nullptr};
+
+        auto search_all = [&](bool exact, key_t* keys, std::size_t* counts) {
+            executor.dynamic(queries_count, [&](std::size_t thread_idx, std::size_t task) {
+                search_result_t search_result = search(queries + task * dimensions, wanted, thread_idx, exact);
+                if (!search_result) {
+                    atomic_error = search_result.error.release();
+                    return false;
+                }
+                counts[task] = search_result.dump_to(keys + task * wanted);
+                return true;
+            });
+        };
+
+        if (!ground_truth) {
+            exact_keys.resize(queries_count * wanted);
+            search_all(true, exact_keys.data(), exact_counts.data());
+            ground_truth = exact_keys.data();
+        }
+
+        std::vector<index_dense_tune_point_t> points;
+        auto probe = [&](std::size_t expansion) {
+            change_expansion_search(expansion);
+            auto start = std::chrono::steady_clock::now();
+            search_all(false, found_keys.data(), found_counts.data());
+            auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::size_t matched = 0, expected = 0;
+            for (std::size_t task = 0; task != queries_count; ++task) {
+                key_t const* exact_row = ground_truth + task * wanted;
+                key_t const* found_row = found_keys.data() + task * wanted;
+                for (std::size_t i = 0; i != exact_counts[task]; ++i)
+                    matched += std::find(found_row, found_row + found_counts[task], exact_row[i]) !=
+                               found_row + found_counts[task];
+                expected += exact_counts[task];
+            }
+
+            index_dense_tune_point_t point;
+            point.expansion = expansion;
+            point.recall = expected ? double(matched) / double(expected) : 1.0;
+            point.queries_per_second = elapsed > 0 ? double(queries_count) / elapsed : 0.0;
+            points.push_back(point);
+            return point.recall >= config.target_recall;
+        };
+
+        // Expansions below `wanted` are equivalent to `wanted`, so that's the cheapest option
+        std::size_t const max_expansion = (std::max)(config.max_expansion, wanted);
+        std::size_t failing = 0, passing = 0;
+        for (std::size_t expansion = wanted; !passing && !atomic_error; expansion *= 2) {
+            expansion = (std::min)(expansion, max_expansion);
+            (probe(expansion) ? passing : failing) = expansion;
+            if (expansion == max_expansion)
+                break;
+        }
+        while (passing && failing && passing - failing > 1 && !atomic_error) {
+            std::size_t middle = failing + (passing - failing) / 2;
+            (probe(middle) ? passing : failing) = middle;
+        }
+
+        if (atomic_error) {
+            change_expansion_search(initial_expansion);
+            return result.failed(atomic_error.load());
+        }
+
+        // Settle for the most accurate option, if none meets the target
+        index_dense_tune_point_t chosen = points.front();
+        for (index_dense_tune_point_t const& point : points)
+            if (passing ? point.expansion == passing : point.recall > chosen.recall)
+                chosen = point;
+        change_expansion_search(chosen.expansion);
+        result.expansion = chosen.expansion;
+        result.recall = chosen.recall;
+        result.queries_per_second = chosen.queries_per_second;
+
+        // Keep the points not dominated by any more accurate one in throughput
+        using point_t = index_dense_tune_point_t;
+        std::sort(points.begin(), points.end(), [](point_t const& a, point_t const& b) {
+            return a.recall == b.recall ? a.queries_per_second > b.queries_per_second : a.recall > b.recall;
+        });
+        double best_throughput = -1;
+        for (index_dense_tune_point_t const& point : points)
+            if (point.queries_per_second > best_throughput) {
+                best_throughput = point.queries_per_second;
+                result.pareto.push_back(point);
+            }
+        std::reverse(result.pareto.begin(), result.pareto.end());
+        return result;
+    }
+
   private:
+    using slots_allocator_t = typename std::allocator_traits<dynamic_allocator_t>::template rebind_alloc<compressed_slot_t>;
+    using slots_buffer_t = buffer_gt<compressed_slot_t, slots_allocator_t>;
+
+    /// @brief Gathers the slots of all the members, that weren't removed, in ascending order.
+    slots_buffer_t present_slots_() const noexcept {
+        slots_buffer_t slots(size());
+        if (!slots)
+            return slots;
+        std::size_t count = 0;
+        for (std::size_t slot = 0; slot != typed_->size() && count != slots.size(); ++slot)
+            if (typed_->at(slot).key != free_key_)
+                slots[count++] = static_cast<compressed_slot_t>(slot);
+        return slots;
+    }
+
     struct thread_lock_t {
         index_dense_gt const& parent;
         std::size_t thread_id;
@@ -1508,17 +2503,20 @@ class index_dense_gt {
         if (thread_id != any_thread())
             return {*this, thread_id, false};
 
-        available_threads_mutex_.lock();
+        // Thread pools wider than the hardware, like the one of libuv on small machines, wait for a free ID
+        std::unique_lock<std::mutex> lock(available_threads_mutex_);
+        available_threads_cv_.wait(lock, [this] { return !available_threads_.empty(); });
         thread_id = available_threads_.back();
         available_threads_.pop_back();
-        available_threads_mutex_.unlock();
         return {*this, thread_id, true};
     }
 
     void thread_unlock_(std::size_t thread_id) const {
-        available_threads_mutex_.lock();
-        available_threads_.push_back(thread_id);
-        available_threads_mutex_.unlock();
+        {
+            std::unique_lock<std::mutex> lock(available_threads_mutex_);
+            available_threads_.push_back(thread_id);
+        }
+        available_threads_cv_.notify_one();
     }
 
     template <typename scalar_at>
@@ -1564,10 +2562,15 @@ class index_dense_gt {
         update_config.thread = lock.thread_id;
         update_config.expansion = config_.expansion_add;
 
+        // Invalidate the cached results only after the new node is linked, so that searches
+        // starting in between can't cache results missing it under the new epoch
         metric_proxy_t metric{*this};
-        return reuse_node //
-                   ? typed_->update(typed_->iterator_at(free_slot), key, vector_data, metric, update_config, on_success)
-                   : typed_->add(key, vector_data, metric, update_config, on_success);
+        add_result_t result =
+            reuse_node //
+                ? typed_->update(typed_->iterator_at(free_slot), key, vector_data, metric, update_config, on_success)
+                : typed_->add(key, vector_data, metric, update_config, on_success);
+        cache_.invalidate();
+        return result;
     }
 
     template <typename scalar_at>
@@ -1579,10 +2582,16 @@ class index_dense_gt {
         thread_lock_t lock = thread_lock_(thread);
         byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
         {
+            bool const timed = typed_->search_stats_enabled();
+            auto cast_start = timed ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
             byte_t* casted_data = cast_buffer_.data() + metric_.bytes_per_vector() * lock.thread_id;
             bool casted = cast(vector_data, dimensions(), casted_data);
             if (casted)
                 vector_data = casted_data;
+            if (timed && casted)
+                typed_->search_stats(lock.thread_id).cast_nanoseconds += static_cast<std::size_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - cast_start)
+                        .count());
         }
 
         index_search_config_t search_config;
@@ -1591,7 +2600,24 @@ class index_dense_gt {
         search_config.exact = exact;
 
         auto allow = [=](member_cref_t const& member) noexcept { return member.key != free_key_; };
-        return typed_->search(vector_data, wanted, metric_proxy_t{*this}, search_config, allow);
+        if (!cache_)
+            return typed_->search(vector_data, wanted, metric_proxy_t{*this}, search_config, allow);
+
+        // The epoch must be captured before the search, to discard its results if the index changes midway
+        std::size_t const bytes_per_vector = metric_.bytes_per_vector();
+        std::uint64_t const epoch = cache_.epoch();
+        std::uint64_t const hash = cache_.hash(vector_data, bytes_per_vector, wanted, search_config.expansion, exact);
+        search_result_t result;
+        auto on_hit = [&](compressed_slot_t const* slots, distance_t const* distances, std::size_t count) {
+            result = typed_->search_result_from(slots, distances, count, lock.thread_id);
+        };
+        if (cache_.find(hash, vector_data, bytes_per_vector, wanted, search_config.expansion, exact, epoch, on_hit))
+            return result;
+
+        result = typed_->search(vector_data, wanted, metric_proxy_t{*this}, search_config, allow);
+        if (result)
+            cache_.insert(hash, vector_data, bytes_per_vector, wanted, search_config.expansion, exact, epoch, result);
+        return result;
     }
 
     template <typename scalar_at>
@@ -1730,35 +2756,6 @@ class index_dense_gt {
             return count_exported;
         }
     }
-
-    template <typename to_scalar_at> static casts_t make_casts_() {
-        casts_t result;
-
-        result.from_b1x8 = cast_gt<b1x8_t, to_scalar_at>{};
-        result.from_i8 = cast_gt<i8_bits_t, to_scalar_at>{};
-        result.from_f16 = cast_gt<f16_t, to_scalar_at>{};
-        result.from_f32 = cast_gt<f32_t, to_scalar_at>{};
-        result.from_f64 = cast_gt<f64_t, to_scalar_at>{};
-
-        result.to_b1x8 = cast_gt<to_scalar_at, b1x8_t>{};
-        result.to_i8 = cast_gt<to_scalar_at, i8_bits_t>{};
-        result.to_f16 = cast_gt<to_scalar_at, f16_t>{};
-        result.to_f32 = cast_gt<to_scalar_at, f32_t>{};
-        result.to_f64 = cast_gt<to_scalar_at, f64_t>{};
-
-        return result;
-    }
-
-    static casts_t make_casts_(scalar_kind_t scalar_kind) {
-        switch (scalar_kind) {
-        case scalar_kind_t::f64_k: return make_casts_<f64_t>();
-        case scalar_kind_t::f32_k: return make_casts_<f32_t>();
-        case scalar_kind_t::f16_k: return make_casts_<f16_t>();
-        case scalar_kind_t::i8_k: return make_casts_<i8_bits_t>();
-        case scalar_kind_t::b1x8_k: return make_casts_<b1x8_t>();
-        default: return {};
-        }
-    }
 };
 
 using index_dense_t = index_dense_gt<>;
@@ -1798,8 +2795,8 @@ static join_result_t join(                                    //
 
     return men.join(                                 //
         women, config,                               //
-        std::forward<woman_to_man_at>(woman_to_man), //
         std::forward<man_to_woman_at>(man_to_woman), //
+        std::forward<woman_to_man_at>(woman_to_man), //
         std::forward<executor_at>(executor),         //
         std::forward<progress_at>(progress));
 }
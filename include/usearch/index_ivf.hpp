@@ -0,0 +1,631 @@
+#pragma once
+#include <condition_variable> // `std::condition_variable`
+#include <memory>             // `std::unique_ptr`
+#include <mutex>              // `std::mutex`
+#include <vector>             // `std::vector`
+
+#include <usearch/index_dense.hpp>
+
+namespace unum {
+namespace usearch {
+
+/**
+ *  @brief  The "magic" sequence helps infer the type of the file.
+ *          Inverted-file indexes start with this string, followed by the coarse quantizer.
+ */
+constexpr char const* default_ivf_magic() { return "usearch.ivf"; }
+
+/// @brief Number of closest inverted lists to scan per query.
+/// Defaults to 1 in FAISS, where it is called `nprobe`.
+constexpr std::size_t default_ivf_probes() { return 8; }
+
+/// @brief Number of list members, which distances are computed together, before selecting the top matches.
+constexpr std::size_t default_ivf_scan_block() { return 64; }
+
+struct index_ivf_config_t {
+    /// @brief Number of closest inverted lists to scan per query.
+    std::size_t probes = default_ivf_probes();
+
+    /// @brief Configuration of the HNSW coarse quantizer, indexing the centroids.
+    index_dense_config_t quantizer;
+
+    index_ivf_config_t() = default;
+    index_ivf_config_t(std::size_t p) noexcept : probes(p ? p : default_ivf_probes()) {}
+};
+
+struct index_ivf_serialized_header_t {
+    char magic[16] = {};
+    std::uint64_t lists = 0;
+    std::uint64_t size = 0;
+    std::uint64_t dimensions = 0;
+    std::uint64_t kind_metric = 0;
+    std::uint64_t kind_scalar = 0;
+    std::uint64_t kind_key = 0;
+};
+
+/**
+ *  @brief  Inverted-File index, built on top of the `index_dense_gt` coarse quantizer.
+ *
+ *  Every member is assigned to the inverted list of the closest centroid, and stored in a contiguous
+ *  block with other members of the same list. Queries first navigate the small HNSW over the centroids,
+ *  and then exhaustively scan the ::probes closest lists. Compared to `index_dense_gt` it trades
+ *  some recall for a much smaller memory footprint, lacking the per-member neighbors lists.
+ *
+ *  Reuses the type-punned metrics, casts, and the serialization of the `index_dense_gt`.
+ *
+ *  @tparam key_at
+ *      The type of primary objects stored in the index.
+ *      The values, to which those map, are not managed by the same index structure.
+ */
+template <typename key_at = default_key_t> //
+class index_ivf_gt {
+  public:
+    using key_t = key_at;
+    using metric_t = metric_punned_t;
+    using distance_t = distance_punned_t;
+    using quantizer_t = index_dense_gt<default_key_t, default_slot_t>;
+
+    struct match_t {
+        key_t key;
+        distance_t distance;
+    };
+
+    struct add_result_t {
+        error_t error{};
+        std::size_t list{};
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        add_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+    };
+
+  private:
+    /// @brief Exclusive use of a thread context, returned to the pool on destruction, if it was taken from there.
+    struct thread_lock_t {
+        index_ivf_gt const* parent{};
+        std::size_t thread_id{};
+        bool engaged{};
+
+        thread_lock_t() = default;
+        thread_lock_t(index_ivf_gt const* parent, std::size_t thread_id, bool engaged) noexcept
+            : parent(parent), thread_id(thread_id), engaged(engaged) {}
+        thread_lock_t(thread_lock_t&& other) noexcept
+            : parent(other.parent), thread_id(other.thread_id), engaged(exchange(other.engaged, false)) {}
+        thread_lock_t& operator=(thread_lock_t&& other) noexcept {
+            std::swap(parent, other.parent);
+            std::swap(thread_id, other.thread_id);
+            std::swap(engaged, other.engaged);
+            return *this;
+        }
+        ~thread_lock_t() {
+            if (engaged)
+                parent->thread_unlock_(thread_id);
+        }
+    };
+
+  public:
+    /**
+     *  @brief Smart object referencing thread-local memory. Valid until next `search()` on the same thread.
+     *         Searches without an explicit thread keep the leased thread context, until the result is destroyed.
+     */
+    struct search_result_t {
+        error_t error{};
+        std::size_t count{};
+        std::size_t visited_lists{};
+        std::size_t computed_distances{};
+        match_t const* matches{};
+        thread_lock_t lock{};
+
+        explicit operator bool() const noexcept { return !error; }
+        search_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+
+        inline std::size_t size() const noexcept { return count; }
+        inline match_t operator[](std::size_t i) const noexcept { return matches[i]; }
+        inline std::size_t dump_to(key_t* keys, distance_t* distances) const noexcept {
+            for (std::size_t i = 0; i != count; ++i)
+                keys[i] = matches[i].key, distances[i] = matches[i].distance;
+            return count;
+        }
+        inline std::size_t dump_to(key_t* keys) const noexcept {
+            for (std::size_t i = 0; i != count; ++i)
+                keys[i] = matches[i].key;
+            return count;
+        }
+    };
+
+  private:
+    using casts_t = casts_punned_t;
+    using cast_t = typename casts_t::cast_t;
+
+    /// @brief A contiguous block of vectors, assigned to the same centroid.
+    struct list_t {
+        std::vector<key_t> keys;
+        std::vector<byte_t> vectors;
+    };
+
+    /// @brief Thread-local memory for the queries.
+    struct context_t {
+        std::vector<byte_t> query;
+        std::vector<default_key_t> probes;
+        std::vector<distance_t> probes_distances;
+        std::vector<distance_t> block_distances;
+        std::vector<match_t> top;
+    };
+
+    using list_mutex_t = unfair_shared_mutex_t;
+    using list_shared_lock_t = shared_lock_gt<list_mutex_t>;
+    using list_unique_lock_t = std::unique_lock<list_mutex_t>;
+
+    index_ivf_config_t config_;
+    metric_t metric_;
+    casts_t casts_;
+    quantizer_t quantizer_;
+
+    std::vector<list_t> lists_;
+    /// @brief Reader-writer locks, one per list, letting many queries scan the same list concurrently.
+    mutable std::unique_ptr<list_mutex_t[]> lists_mutexes_;
+    std::atomic<std::size_t> size_{0};
+
+    mutable std::vector<context_t> contexts_;
+    mutable std::vector<std::size_t> available_threads_;
+    mutable std::mutex available_threads_mutex_;
+    /// @brief Wakes up the callers waiting for a free thread ID, when more callers than IDs enter at once.
+    mutable std::condition_variable available_threads_cv_;
+
+  public:
+    index_ivf_gt() = default;
+    index_ivf_gt(index_ivf_gt&& other) { swap(other); }
+    index_ivf_gt& operator=(index_ivf_gt&& other) {
+        swap(other);
+        return *this;
+    }
+
+    void swap(index_ivf_gt& other) {
+        std::swap(config_, other.config_);
+        std::swap(metric_, other.metric_);
+        std::swap(casts_, other.casts_);
+        std::swap(quantizer_, other.quantizer_);
+        std::swap(lists_, other.lists_);
+        std::swap(lists_mutexes_, other.lists_mutexes_);
+        size_ = other.size_.exchange(size_.load());
+        std::swap(contexts_, other.contexts_);
+        std::swap(available_threads_, other.available_threads_);
+    }
+
+    /**
+     *  @brief Constructs an instance of ::index_ivf_gt without any inverted lists.
+     *  @param[in] metric One of the provided or an @b ad-hoc metric, type-punned.
+     *  @param[in] config The index configuration (optional).
+     *  @return An instance of ::index_ivf_gt, to be `train`-ed before use.
+     */
+    static index_ivf_gt make(metric_t metric, index_ivf_config_t config = {}) {
+        std::size_t hardware_threads = std::thread::hardware_concurrency();
+
+        index_ivf_gt result;
+        result.config_ = config;
+        result.metric_ = metric;
+        result.casts_ = casts_t::make(metric.scalar_kind());
+        result.quantizer_ = quantizer_t::make(metric, config.quantizer);
+        result.contexts_.resize(hardware_threads);
+        for (context_t& context : result.contexts_)
+            context.query.resize(metric.bytes_per_vector());
+
+        // Fill the thread IDs.
+        result.available_threads_.resize(hardware_threads);
+        std::iota(result.available_threads_.begin(), result.available_threads_.end(), 0ul);
+        return result;
+    }
+
+    explicit operator bool() const { return bool(quantizer_); }
+    std::size_t size() const { return size_.load(); }
+    std::size_t lists() const { return lists_.size(); }
+    std::size_t list_size(std::size_t list) const { return lists_[list].keys.size(); }
+    std::size_t probes() const { return config_.probes; }
+    void change_probes(std::size_t probes) { config_.probes = probes; }
+    index_ivf_config_t const& config() const { return config_; }
+    quantizer_t const& quantizer() const { return quantizer_; }
+
+    // The metric and its properties
+    metric_t const& metric() const { return metric_; }
+    scalar_kind_t scalar_kind() const noexcept { return metric_.scalar_kind(); }
+    std::size_t bytes_per_vector() const noexcept { return metric_.bytes_per_vector(); }
+    std::size_t dimensions() const noexcept { return metric_.dimensions(); }
+
+    static constexpr std::size_t any_thread() { return std::numeric_limits<std::size_t>::max(); }
+
+    /**
+     *  @brief  Reserves memory for the threads contexts and the inverted lists.
+     *          The ::limits.members are spread evenly across the lists.
+     */
+    bool reserve(index_limits_t limits) {
+        std::size_t threads = (std::max)(limits.threads(), contexts_.size());
+        if (!quantizer_.reserve({lists_.size(), threads}))
+            return false;
+        if (threads > contexts_.size()) {
+            std::unique_lock<std::mutex> lock(available_threads_mutex_);
+            for (std::size_t thread = contexts_.size(); thread != threads; ++thread)
+                available_threads_.push_back(thread);
+            contexts_.resize(threads);
+            for (context_t& context : contexts_)
+                context.query.resize(metric_.bytes_per_vector());
+            available_threads_cv_.notify_all();
+        }
+        if (lists_.empty())
+            return true;
+
+        std::size_t per_list = divide_round_up(limits.members, lists_.size());
+        for (list_t& list : lists_) {
+            list.keys.reserve(per_list);
+            list.vectors.reserve(per_list * metric_.bytes_per_vector());
+        }
+        return true;
+    }
+
+    /**
+     *  @brief  Installs the coarse centroids, one inverted list per centroid.
+     *          Can only be called once, before any entries are added.
+     *
+     *  @param[in] centroids Matrix of `count x dimensions()` single-precision centroids.
+     *  @param[in] count Number of centroids, and the resulting inverted lists.
+     */
+    template <typename executor_at = dummy_executor_t>
+    add_result_t train(f32_t const* centroids, std::size_t count, executor_at&& executor = executor_at{}) {
+        add_result_t result;
+        if (!lists_.empty())
+            return result.failed("Index is already trained");
+        if (!count)
+            return result.failed("Number of centroids must be positive");
+
+        std::unique_ptr<list_mutex_t[]> new_mutexes(new (std::nothrow) list_mutex_t[count]);
+        if (!new_mutexes || !quantizer_.reserve({count, (std::max)(executor.size(), contexts_.size())}))
+            return result.failed("Out of memory!");
+
+        std::atomic<char const*> atomic_error{nullptr};
+        executor.dynamic(count, [&](std::size_t thread_idx, std::size_t list) {
+            auto add_result = quantizer_.add(static_cast<default_key_t>(list), centroids + list * dimensions(),
+                                             thread_idx);
+            if (!add_result) {
+                atomic_error = add_result.error.release();
+                return false;
+            }
+            return true;
+        });
+        if (atomic_error)
+            return result.failed(atomic_error.load());
+
+        lists_.resize(count);
+        lists_mutexes_ = std::move(new_mutexes);
+        return result;
+    }
+
+    /**
+     *  @brief  Builds the inverted lists from an existing HNSW index, partitioning it with k-Means.
+     *          Every vector of the ::source is copied, so the source can be freed afterwards.
+     *
+     *  @param[in] source The index to copy the vectors from, using the same metric and scalar type.
+     *  @param[in] config The number of lists and the k-Means iterations schedule.
+     *  @param[in] executor Thread-pool to execute the job in parallel.
+     *  @param[in] progress Callback to report the execution progress.
+     */
+    template <                                   //
+        typename source_slot_at,                 //
+        typename executor_at = dummy_executor_t, //
+        typename progress_at = dummy_progress_t  //
+        >
+    add_result_t train(                                      //
+        index_dense_gt<key_t, source_slot_at> const& source, //
+        index_dense_kmeans_config_t config,                  //
+        executor_at&& executor = executor_at{},              //
+        progress_at&& progress = progress_at{}) {
+
+        add_result_t result;
+        if (source.multi())
+            return result.failed("Multi-key indexes can't be partitioned by keys");
+        if (source.metric().scalar_kind() != metric_.scalar_kind() ||
+            source.metric().bytes_per_vector() != metric_.bytes_per_vector())
+            return result.failed("Source index uses a different vector representation");
+
+        std::size_t const count = source.size();
+        std::vector<f32_t> centroids(config.clusters * dimensions());
+        std::vector<key_t> members_keys(count);
+        std::vector<std::size_t> members_clusters(count);
+        auto kmeans_result = source.kmeans(config, centroids.data(), members_keys.data(), members_clusters.data(),
+                                           nullptr, executor, progress);
+        if (!kmeans_result)
+            return result.failed(kmeans_result.error.release());
+
+        result = train(centroids.data(), config.clusters, executor);
+        if (!result)
+            return result;
+
+        // Size the lists upfront, to fill the blocks without reallocations.
+        // The vectors are exported into double-precision, which can losslessly represent any other scalar type.
+        std::vector<std::size_t> lists_sizes(lists_.size());
+        for (std::size_t member = 0; member != count; ++member)
+            lists_sizes[members_clusters[member]]++;
+        for (std::size_t list = 0; list != lists_.size(); ++list) {
+            lists_[list].keys.reserve(lists_sizes[list]);
+            lists_[list].vectors.reserve(lists_sizes[list] * bytes_per_vector());
+        }
+
+        std::vector<f64_t> exported(dimensions());
+        std::vector<byte_t> casted(bytes_per_vector());
+        for (std::size_t member = 0; member != count; ++member) {
+            source.get(members_keys[member], exported.data());
+            append_(members_clusters[member], members_keys[member], exported.data(), casted.data(), casts_.from_f64);
+        }
+        return result;
+    }
+
+    // clang-format off
+    add_result_t add(key_t key, b1x8_t const* vector, std::size_t thread = any_thread()) { return add_(key, vector, thread, casts_.from_b1x8); }
+    add_result_t add(key_t key, i8_bits_t const* vector, std::size_t thread = any_thread()) { return add_(key, vector, thread, casts_.from_i8); }
+    add_result_t add(key_t key, f16_t const* vector, std::size_t thread = any_thread()) { return add_(key, vector, thread, casts_.from_f16); }
+    add_result_t add(key_t key, f32_t const* vector, std::size_t thread = any_thread()) { return add_(key, vector, thread, casts_.from_f32); }
+    add_result_t add(key_t key, f64_t const* vector, std::size_t thread = any_thread()) { return add_(key, vector, thread, casts_.from_f64); }
+
+    search_result_t search(b1x8_t const* vector, std::size_t wanted, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, casts_.from_b1x8); }
+    search_result_t search(i8_bits_t const* vector, std::size_t wanted, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, casts_.from_i8); }
+    search_result_t search(f16_t const* vector, std::size_t wanted, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, casts_.from_f16); }
+    search_result_t search(f32_t const* vector, std::size_t wanted, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, casts_.from_f32); }
+    search_result_t search(f64_t const* vector, std::size_t wanted, std::size_t thread = any_thread()) const { return search_(vector, wanted, thread, casts_.from_f64); }
+    // clang-format on
+
+    /**
+     *  @brief  Computes the memory usage of the index, including the coarse quantizer.
+     */
+    std::size_t memory_usage() const {
+        std::size_t result = quantizer_.memory_usage() + lists_.capacity() * sizeof(list_t);
+        for (list_t const& list : lists_)
+            result += list.keys.capacity() * sizeof(key_t) + list.vectors.capacity();
+        return result;
+    }
+
+    /**
+     *  @brief Saves the index to a file.
+     *  @param[in] path The path to the file.
+     *  @return Outcome descriptor explicitly convertible to boolean.
+     */
+    serialization_result_t save(output_file_t file) const {
+        serialization_result_t result = file.open_if_not();
+        if (result)
+            stream([&](void* buffer, std::size_t length) {
+                result = file.write(buffer, length);
+                return !!result;
+            });
+        return result;
+    }
+
+    /**
+     *  @brief  Saves serialized binary index representation to a stream.
+     *          The header and the inverted lists are followed by the coarse quantizer.
+     */
+    template <typename output_callback_at> serialization_result_t stream(output_callback_at&& callback) const {
+        serialization_result_t result;
+        index_ivf_serialized_header_t header;
+        std::memcpy(header.magic, default_ivf_magic(), std::strlen(default_ivf_magic()));
+        header.lists = lists_.size();
+        header.size = size();
+        header.dimensions = dimensions();
+        header.kind_metric = static_cast<std::uint64_t>(metric_.metric_kind());
+        header.kind_scalar = static_cast<std::uint64_t>(metric_.scalar_kind());
+        header.kind_key = static_cast<std::uint64_t>(unum::usearch::scalar_kind<key_t>());
+        if (!callback(&header, sizeof(header)))
+            return result.failed("Failed to serialize into stream");
+
+        for (list_t const& list : lists_) {
+            std::uint64_t list_size = list.keys.size();
+            if (!callback(&list_size, sizeof(list_size)))
+                return result.failed("Failed to serialize into stream");
+            if (list_size && !callback((void*)list.keys.data(), list_size * sizeof(key_t)))
+                return result.failed("Failed to serialize into stream");
+            if (list_size && !callback((void*)list.vectors.data(), list_size * bytes_per_vector()))
+                return result.failed("Failed to serialize into stream");
+        }
+
+        return quantizer_.stream(std::forward<output_callback_at>(callback));
+    }
+
+    /**
+     *  @brief  Estimate the binary length (in bytes) of the serialized index.
+     */
+    std::size_t stream_length() const noexcept {
+        std::size_t lists_length = lists_.size() * sizeof(std::uint64_t);
+        std::size_t members_length = size() * (sizeof(key_t) + bytes_per_vector());
+        return sizeof(index_ivf_serialized_header_t) + lists_length + members_length + quantizer_.stream_length();
+    }
+
+    /**
+     *  @brief Parses the index from file to RAM.
+     *  @param[in] path The path to the file.
+     *  @return Outcome descriptor explicitly convertible to boolean.
+     */
+    serialization_result_t load(input_file_t file) {
+        serialization_result_t result = file.open_if_not();
+        if (!result)
+            return result;
+
+        index_ivf_serialized_header_t header;
+        result = file.read(&header, sizeof(header));
+        if (!result)
+            return result;
+        if (std::memcmp(header.magic, default_ivf_magic(), std::strlen(default_ivf_magic())) != 0)
+            return result.failed("Magic header mismatch - the file isn't an inverted-file index");
+        if (header.kind_key != static_cast<std::uint64_t>(unum::usearch::scalar_kind<key_t>()))
+            return result.failed("Key type doesn't match, consider rebuilding");
+
+        metric_t metric(                                   //
+            static_cast<std::size_t>(header.dimensions),   //
+            static_cast<metric_kind_t>(header.kind_metric), //
+            static_cast<scalar_kind_t>(header.kind_scalar));
+        index_ivf_gt loaded = make(metric, config_);
+        loaded.lists_.resize(header.lists);
+        loaded.lists_mutexes_.reset(new (std::nothrow) list_mutex_t[header.lists]);
+        if (header.lists && !loaded.lists_mutexes_)
+            return result.failed("Out of memory!");
+
+        for (list_t& list : loaded.lists_) {
+            std::uint64_t list_size = 0;
+            result = file.read(&list_size, sizeof(list_size));
+            if (!result)
+                return result;
+            list.keys.resize(list_size);
+            list.vectors.resize(list_size * loaded.bytes_per_vector());
+            if (list_size && !(result = file.read(list.keys.data(), list_size * sizeof(key_t))))
+                return result;
+            if (list_size && !(result = file.read(list.vectors.data(), list.vectors.size())))
+                return result;
+        }
+        loaded.size_ = header.size;
+
+        result = loaded.quantizer_.load(std::move(file));
+        if (!result)
+            return result;
+        if (loaded.quantizer_.size() != header.lists)
+            return result.failed("Number of centroids and inverted lists doesn't match");
+
+        swap(loaded);
+        return result;
+    }
+
+  private:
+    thread_lock_t thread_lock_(std::size_t thread_id) const {
+        if (thread_id != any_thread())
+            return {this, thread_id, false};
+
+        // Thread pools wider than the hardware wait for a free ID
+        std::unique_lock<std::mutex> lock(available_threads_mutex_);
+        available_threads_cv_.wait(lock, [this] { return !available_threads_.empty(); });
+        thread_id = available_threads_.back();
+        available_threads_.pop_back();
+        return {this, thread_id, true};
+    }
+
+    void thread_unlock_(std::size_t thread_id) const {
+        {
+            std::unique_lock<std::mutex> lock(available_threads_mutex_);
+            available_threads_.push_back(thread_id);
+        }
+        available_threads_cv_.notify_one();
+    }
+
+    /// @brief Casts and appends a vector to the end of an inverted list.
+    template <typename scalar_at>
+    void append_(std::size_t list_idx, key_t key, scalar_at const* vector, byte_t* casted_data, cast_t const& cast) {
+        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
+        std::memset(casted_data, 0, bytes_per_vector());
+        if (cast(vector_data, dimensions(), casted_data))
+            vector_data = casted_data;
+
+        list_t& list = lists_[list_idx];
+        {
+            list_unique_lock_t lock(lists_mutexes_[list_idx]);
+            list.keys.push_back(key);
+            list.vectors.insert(list.vectors.end(), vector_data, vector_data + bytes_per_vector());
+        }
+        ++size_;
+    }
+
+    template <typename scalar_at>
+    add_result_t add_(key_t key, scalar_at const* vector, std::size_t thread, cast_t const& cast) {
+        add_result_t result;
+        if (lists_.empty())
+            return result.failed("Index must be trained before adding entries");
+
+        thread_lock_t lock = thread_lock_(thread);
+        context_t& context = contexts_[lock.thread_id];
+
+        // Choose the closest list with the coarse quantizer
+        auto closest = quantizer_.search(vector, 1, lock.thread_id);
+        if (!closest)
+            return result.failed(closest.error.release());
+        if (!closest.size())
+            return result.failed("Coarse quantizer is empty");
+
+        result.list = static_cast<std::size_t>(closest[0].member.key);
+        result.computed_distances = closest.computed_distances;
+        append_(result.list, key, vector, context.query.data(), cast);
+        return result;
+    }
+
+    template <typename scalar_at>
+    search_result_t search_(scalar_at const* vector, std::size_t wanted, std::size_t thread, cast_t const& cast) const {
+        search_result_t result;
+        if (lists_.empty() || !wanted)
+            return result;
+
+        thread_lock_t lock = thread_lock_(thread);
+        context_t& context = contexts_[lock.thread_id];
+
+        // Cast the vector, if needed for compatibility with `metric_`
+        byte_t const* vector_data = reinterpret_cast<byte_t const*>(vector);
+        {
+            byte_t* casted_data = context.query.data();
+            std::memset(casted_data, 0, bytes_per_vector());
+            bool casted = cast(vector_data, dimensions(), casted_data);
+            if (casted)
+                vector_data = casted_data;
+        }
+
+        // Find the closest lists with the coarse quantizer
+        std::size_t probes = (std::min)(config_.probes, lists_.size());
+        context.probes.resize(probes);
+        context.probes_distances.resize(probes);
+        auto closest = quantizer_.search(vector, probes, lock.thread_id);
+        if (!closest)
+            return result.failed(closest.error.release());
+        probes = closest.dump_to(context.probes.data(), context.probes_distances.data());
+        result.computed_distances = closest.computed_distances;
+
+        // Scan the contiguous blocks of the chosen lists, keeping the top matches sorted.
+        // Distances are computed a block at a time, keeping the metric loop free of the selection branches.
+        std::vector<match_t>& top = context.top;
+        std::vector<distance_t>& block_distances = context.block_distances;
+        top.clear();
+        top.reserve(wanted + 1);
+        block_distances.resize(default_ivf_scan_block());
+        auto farther = [](match_t const& a, match_t const& b) { return a.distance < b.distance; };
+        std::size_t const stride = bytes_per_vector();
+        for (std::size_t probe = 0; probe != probes; ++probe) {
+            std::size_t list_idx = static_cast<std::size_t>(context.probes[probe]);
+            list_t const& list = lists_[list_idx];
+            list_shared_lock_t lock(lists_mutexes_[list_idx]);
+            std::size_t const list_size = list.keys.size();
+            byte_t const* list_vectors = list.vectors.data();
+            for (std::size_t block = 0; block < list_size; block += default_ivf_scan_block()) {
+                std::size_t const block_size = (std::min)(default_ivf_scan_block(), list_size - block);
+                byte_t const* block_vectors = list_vectors + block * stride;
+                for (std::size_t i = 0; i != block_size; ++i)
+                    block_distances[i] = metric_(vector_data, block_vectors + i * stride);
+
+                for (std::size_t i = 0; i != block_size; ++i) {
+                    distance_t distance = block_distances[i];
+                    if (top.size() == wanted && !(distance < top.back().distance))
+                        continue;
+                    match_t match{list.keys[block + i], distance};
+                    top.insert(std::upper_bound(top.begin(), top.end(), match, farther), match);
+                    if (top.size() > wanted)
+                        top.pop_back();
+                }
+            }
+            result.computed_distances += list_size;
+        }
+
+        result.visited_lists = probes;
+        result.count = top.size();
+        result.matches = top.data();
+        result.lock = std::move(lock);
+        return result;
+    }
+};
+
+using index_ivf_t = index_ivf_gt<>;
+
+} // namespace usearch
+} // namespace unum
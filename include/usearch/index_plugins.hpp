@@ -1,10 +1,12 @@
 #pragma once
 #include <stdlib.h> // `aligned_alloc`
 
-#include <cstring> // `std::strncmp`
-#include <numeric> // `std::iota`
-#include <thread>  // `std::thread`
-#include <vector>  // `std::vector`
+#include <cstring>    // `std::strncmp`
+#include <functional> // `std::function`
+#include <memory>     // `std::shared_ptr`
+#include <numeric>    // `std::iota`
+#include <thread>     // `std::thread`
+#include <vector>     // `std::vector`
 
 #include <atomic> // `std::atomic`
 #include <thread> // `std::thread`
@@ -669,6 +671,57 @@ class aligned_allocator_gt {
 
 using aligned_allocator_t = aligned_allocator_gt<>;
 
+/**
+ *  @brief  Forwards to `std::allocator`, tracking the number of bytes currently allocated.
+ *          Copies and rebinds share the counter, so a node-based STL container reports all of its allocations.
+ *          @b Thread-safe, if the container itself is used safely.
+ */
+template <typename element_at = char> class counting_allocator_gt {
+    template <typename> friend class counting_allocator_gt;
+    std::shared_ptr<std::atomic<std::size_t>> allocated_;
+
+  public:
+    using value_type = element_at;
+    using size_type = std::size_t;
+    using pointer = element_at*;
+    using const_pointer = element_at const*;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    template <typename other_element_at> struct rebind {
+        using other = counting_allocator_gt<other_element_at>;
+    };
+
+    counting_allocator_gt() : allocated_(std::make_shared<std::atomic<std::size_t>>(0)) {}
+    template <typename other_element_at>
+    counting_allocator_gt(counting_allocator_gt<other_element_at> const& other) noexcept
+        : allocated_(other.allocated_) {}
+
+    /// @brief Copied containers count their own allocations.
+    counting_allocator_gt select_on_container_copy_construction() const { return {}; }
+
+    pointer allocate(size_type length) {
+        pointer result = std::allocator<element_at>{}.allocate(length);
+        *allocated_ += length * sizeof(element_at);
+        return result;
+    }
+
+    void deallocate(pointer begin, size_type length) noexcept {
+        std::allocator<element_at>{}.deallocate(begin, length);
+        *allocated_ -= length * sizeof(element_at);
+    }
+
+    std::size_t total_allocated() const noexcept { return allocated_->load(std::memory_order_relaxed); }
+
+    template <typename other_element_at>
+    bool operator==(counting_allocator_gt<other_element_at> const& other) const noexcept {
+        return allocated_ == other.allocated_;
+    }
+    template <typename other_element_at>
+    bool operator!=(counting_allocator_gt<other_element_at> const& other) const noexcept {
+        return allocated_ != other.allocated_;
+    }
+};
+
 /**
  *  @brief  Memory-mapping allocator designed for "alloc many, free at once" usage patterns.
  *          @b Thread-safe, @b except constructors and destructors.
@@ -783,6 +836,7 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
             last_arena_ = new_arena;
             last_capacity_ = new_cap;
             last_usage_ = head_size();
+            usearch_trace_m(arena__grow, new_arena, new_cap);
         }
 
         wasted_space_ += extended_bytes - count_bytes;
@@ -794,14 +848,14 @@ template <std::size_t alignment_ak = 1> class memory_mapping_allocator_gt {
      *  @return The amount of space in bytes.
      */
     std::size_t total_allocated() const noexcept {
-        if (!last_arena_)
-            return 0;
         std::size_t total_used = 0;
-        std::size_t last_capacity = last_capacity_;
-        do {
-            total_used += last_capacity;
-            last_capacity /= capacity_multiplier();
-        } while (last_capacity >= min_capacity());
+        byte_t* last_arena = last_arena_;
+        while (last_arena) {
+            std::size_t last_cap;
+            std::memcpy(&last_cap, last_arena + sizeof(byte_t*), sizeof(std::size_t));
+            std::memcpy(&last_arena, last_arena, sizeof(byte_t*));
+            total_used += last_cap;
+        }
         return total_used;
     }
 
@@ -1437,5 +1491,57 @@ class metric_punned_t {
     // clang-format on
 };
 
+/**
+ *  @brief  Type-punned casting functions between the user-facing scalar types
+ *          and the scalar type, used to store vectors in an index.
+ *          The `from_*` members convert into the storage type, `to_*` - out of it.
+ *          Every function returns `false`, if no conversion was needed.
+ */
+struct casts_punned_t {
+    /// @brief Schema: input buffer, bytes in input buffer, output buffer.
+    using cast_t = std::function<bool(byte_t const*, std::size_t, byte_t*)>;
+
+    cast_t from_b1x8;
+    cast_t from_i8;
+    cast_t from_f16;
+    cast_t from_f32;
+    cast_t from_f64;
+
+    cast_t to_b1x8;
+    cast_t to_i8;
+    cast_t to_f16;
+    cast_t to_f32;
+    cast_t to_f64;
+
+    template <typename to_scalar_at> static casts_punned_t make() {
+        casts_punned_t result;
+
+        result.from_b1x8 = cast_gt<b1x8_t, to_scalar_at>{};
+        result.from_i8 = cast_gt<i8_bits_t, to_scalar_at>{};
+        result.from_f16 = cast_gt<f16_t, to_scalar_at>{};
+        result.from_f32 = cast_gt<f32_t, to_scalar_at>{};
+        result.from_f64 = cast_gt<f64_t, to_scalar_at>{};
+
+        result.to_b1x8 = cast_gt<to_scalar_at, b1x8_t>{};
+        result.to_i8 = cast_gt<to_scalar_at, i8_bits_t>{};
+        result.to_f16 = cast_gt<to_scalar_at, f16_t>{};
+        result.to_f32 = cast_gt<to_scalar_at, f32_t>{};
+        result.to_f64 = cast_gt<to_scalar_at, f64_t>{};
+
+        return result;
+    }
+
+    static casts_punned_t make(scalar_kind_t scalar_kind) {
+        switch (scalar_kind) {
+        case scalar_kind_t::f64_k: return make<f64_t>();
+        case scalar_kind_t::f32_k: return make<f32_t>();
+        case scalar_kind_t::f16_k: return make<f16_t>();
+        case scalar_kind_t::i8_k: return make<i8_bits_t>();
+        case scalar_kind_t::b1x8_k: return make<b1x8_t>();
+        default: return {};
+        }
+    }
+};
+
 } // namespace usearch
 } // namespace unum
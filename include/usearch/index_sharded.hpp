@@ -0,0 +1,299 @@
+#pragma once
+#include <cmath>  // `std::sqrt`
+#include <mutex>  // `std::mutex`
+#include <string> // `std::to_string`
+#include <vector> // `std::vector`
+
+#include <usearch/index_dense.hpp>
+
+namespace unum {
+namespace usearch {
+
+/**
+ *  @brief  Collection of independent `index_dense_gt` shards behind a single facade.
+ *
+ *  Beyond 4 Billion entries a single index would need `uint40_t` slots, inflating every neighbors list.
+ *  Splitting the collection into shards keeps the compact 32-bit slots, and lets a single query use
+ *  many cores at once: the shards are searched concurrently and their results are merged.
+ *
+ *  Entries are routed to shards by the hash of their key, so all the vectors of a key end up in the
+ *  same shard, and lookups, updates and removals touch just one of them.
+ *  Every shard is serialized into its own file, so they can be saved, loaded, or rebuilt independently.
+ *
+ *  @tparam key_at
+ *      The type of primary objects stored in the index.
+ *      The values, to which those map, are not managed by the same index structure.
+ *
+ *  @tparam compressed_slot_at
+ *      The smallest unsigned integer type to address indexed elements within each shard.
+ */
+template <typename key_at = default_key_t, typename compressed_slot_at = std::uint32_t> //
+class index_sharded_gt {
+  public:
+    using key_t = key_at;
+    using compressed_slot_t = compressed_slot_at;
+    using metric_t = metric_punned_t;
+    using distance_t = distance_punned_t;
+    using shard_t = index_dense_gt<key_t, compressed_slot_t>;
+    using add_result_t = typename shard_t::add_result_t;
+    using labeling_result_t = typename shard_t::labeling_result_t;
+
+    /**
+     *  @brief  Outcome of a search across all shards, merged into the caller-supplied arrays.
+     */
+    struct search_result_t {
+        error_t error{};
+        /** @brief  Number of search results merged from all the shards. */
+        std::size_t count{};
+        /** @brief  Number of graph nodes traversed, summed across shards. */
+        std::size_t visited_members{};
+        /** @brief  Number of times the distances were computed, summed across shards. */
+        std::size_t computed_distances{};
+
+        explicit operator bool() const noexcept { return !error; }
+        search_result_t failed(error_t message) noexcept {
+            error = std::move(message);
+            return std::move(*this);
+        }
+
+        inline std::size_t size() const noexcept { return count; }
+    };
+
+  private:
+    std::vector<shard_t> shards_;
+
+  public:
+    index_sharded_gt() = default;
+    index_sharded_gt(index_sharded_gt&&) = default;
+    index_sharded_gt& operator=(index_sharded_gt&&) = default;
+
+    void swap(index_sharded_gt& other) { std::swap(shards_, other.shards_); }
+
+    /**
+     *  @brief Constructs an instance of ::index_sharded_gt.
+     *  @param[in] metric One of the provided or an @b ad-hoc metric, type-punned.
+     *  @param[in] shards Number of independent shards, must be positive.
+     *  @param[in] config The configuration of every shard (optional).
+     *  @param[in] free_key The key used for freed vectors (optional).
+     *  @return An instance of ::index_sharded_gt, empty if the construction failed.
+     */
+    static index_sharded_gt make(         //
+        metric_t metric,                  //
+        std::size_t shards,               //
+        index_dense_config_t config = {}, //
+        key_t free_key = default_free_value<key_t>()) {
+
+        index_sharded_gt result;
+        result.shards_.reserve(shards);
+        for (std::size_t shard = 0; shard != shards; ++shard) {
+            result.shards_.push_back(shard_t::make(metric, config, free_key));
+            if (!result.shards_.back())
+                return {};
+        }
+        return result;
+    }
+
+    explicit operator bool() const { return !shards_.empty(); }
+    std::size_t shards() const noexcept { return shards_.size(); }
+    shard_t const& shard(std::size_t i) const noexcept { return shards_[i]; }
+    shard_t& shard(std::size_t i) noexcept { return shards_[i]; }
+
+    /**
+     *  @brief  Chooses the shard responsible for a given key.
+     *          Mixes the bits of the hash, as `std::hash` of integers is often the identity function.
+     */
+    std::size_t shard_of(key_t const& key) const noexcept {
+        std::uint64_t hash = static_cast<std::uint64_t>(hash_gt<key_t>{}(key));
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        return static_cast<std::size_t>(hash % shards_.size());
+    }
+
+    std::size_t size() const {
+        std::size_t result = 0;
+        for (shard_t const& shard : shards_)
+            result += shard.size();
+        return result;
+    }
+
+    std::size_t capacity() const {
+        std::size_t result = 0;
+        for (shard_t const& shard : shards_)
+            result += shard.capacity();
+        return result;
+    }
+
+    std::size_t memory_usage() const {
+        std::size_t result = shards_.capacity() * sizeof(shard_t);
+        for (shard_t const& shard : shards_)
+            result += shard.memory_usage();
+        return result;
+    }
+
+    // The metric and its properties
+    metric_t const& metric() const { return shards_.front().metric(); }
+    scalar_kind_t scalar_kind() const noexcept { return metric().scalar_kind(); }
+    std::size_t bytes_per_vector() const noexcept { return metric().bytes_per_vector(); }
+    std::size_t dimensions() const noexcept { return metric().dimensions(); }
+
+    void change_expansion_add(std::size_t n) {
+        for (shard_t& shard : shards_)
+            shard.change_expansion_add(n);
+    }
+
+    void change_expansion_search(std::size_t n) {
+        for (shard_t& shard : shards_)
+            shard.change_expansion_search(n);
+    }
+
+    static constexpr std::size_t any_thread() { return shard_t::any_thread(); }
+
+    /**
+     *  @brief  Reserves memory in every shard, splitting ::limits.members between them.
+     *          Leaves some headroom, as the hashed keys are never spread perfectly evenly.
+     */
+    bool reserve(index_limits_t limits) {
+        std::size_t per_shard = divide_round_up(limits.members, shards_.size());
+        per_shard += static_cast<std::size_t>(4 * std::sqrt(static_cast<double>(per_shard))) + 1;
+        for (shard_t& shard : shards_)
+            if (!shard.reserve({per_shard, limits.threads()}))
+                return false;
+        return true;
+    }
+
+    bool contains(key_t key) const { return shards_[shard_of(key)].contains(key); }
+    std::size_t count(key_t key) const { return shards_[shard_of(key)].count(key); }
+    labeling_result_t remove(key_t key) { return shards_[shard_of(key)].remove(key); }
+
+    // clang-format off
+    add_result_t add(key_t key, b1x8_t const* vector, std::size_t thread = any_thread()) { return shards_[shard_of(key)].add(key, vector, thread); }
+    add_result_t add(key_t key, i8_bits_t const* vector, std::size_t thread = any_thread()) { return shards_[shard_of(key)].add(key, vector, thread); }
+    add_result_t add(key_t key, f16_t const* vector, std::size_t thread = any_thread()) { return shards_[shard_of(key)].add(key, vector, thread); }
+    add_result_t add(key_t key, f32_t const* vector, std::size_t thread = any_thread()) { return shards_[shard_of(key)].add(key, vector, thread); }
+    add_result_t add(key_t key, f64_t const* vector, std::size_t thread = any_thread()) { return shards_[shard_of(key)].add(key, vector, thread); }
+
+    bool get(key_t key, b1x8_t* vector, std::size_t vectors_count = 1) const { return shards_[shard_of(key)].get(key, vector, vectors_count); }
+    bool get(key_t key, i8_bits_t* vector, std::size_t vectors_count = 1) const { return shards_[shard_of(key)].get(key, vector, vectors_count); }
+    bool get(key_t key, f16_t* vector, std::size_t vectors_count = 1) const { return shards_[shard_of(key)].get(key, vector, vectors_count); }
+    bool get(key_t key, f32_t* vector, std::size_t vectors_count = 1) const { return shards_[shard_of(key)].get(key, vector, vectors_count); }
+    bool get(key_t key, f64_t* vector, std::size_t vectors_count = 1) const { return shards_[shard_of(key)].get(key, vector, vectors_count); }
+    // clang-format on
+
+    /**
+     *  @brief  Searches every shard concurrently, merging the results into the caller-supplied arrays.
+     *
+     *  @param[in] vector The query vector, of any scalar type supported by the shards.
+     *  @param[in] wanted The maximum number of results to return.
+     *  @param[out] keys The keys of the closest entries, sorted by distance. Must fit ::wanted entries.
+     *  @param[out] distances The distances to the closest entries. Must fit ::wanted entries.
+     *  @param[in] executor Thread-pool to fan the query out across the shards.
+     */
+    template <typename scalar_at, typename executor_at = dummy_executor_t>
+    search_result_t search(                    //
+        scalar_at const* vector,            //
+        std::size_t wanted,                 //
+        key_t* keys, distance_t* distances, //
+        executor_at&& executor = executor_at{}) const {
+
+        search_result_t result;
+        if (!wanted)
+            return result;
+
+        // Every shard is searched for the same number of candidates, and merged as soon as possible,
+        // while the thread-local memory of the shard still holds its results.
+        std::mutex merge_mutex;
+        std::atomic<char const*> atomic_error{nullptr};
+        executor.dynamic(shards_.size(), [&](std::size_t, std::size_t shard) {
+            auto shard_result = shards_[shard].search(vector, wanted);
+            if (!shard_result) {
+                atomic_error = shard_result.error.release();
+                return false;
+            }
+
+            std::unique_lock<std::mutex> lock(merge_mutex);
+            result.count = shard_result.merge_into(keys, distances, result.count, wanted);
+            result.visited_members += shard_result.visited_members;
+            result.computed_distances += shard_result.computed_distances;
+            return true;
+        });
+
+        if (atomic_error)
+            return result.failed(atomic_error.load());
+        return result;
+    }
+
+    /**
+     *  @brief  Composes the path of a single shard file, appending the shard index to the ::path.
+     */
+    static std::string shard_path(char const* path, std::size_t shard) {
+        return std::string(path) + "." + std::to_string(shard);
+    }
+
+    /**
+     *  @brief  Saves every shard into a separate file, named by `shard_path`.
+     *  @param[in] path The common prefix of the shard files.
+     *  @param[in] executor Thread-pool to save the shards in parallel.
+     *  @return Outcome descriptor explicitly convertible to boolean.
+     */
+    template <typename executor_at = dummy_executor_t>
+    serialization_result_t save(char const* path, executor_at&& executor = executor_at{}) const {
+        return for_each_shard_file_(shards_, path, executor, [](shard_t const& shard, char const* shard_path) {
+            return shard.save(shard_path);
+        });
+    }
+
+    /**
+     *  @brief  Loads every shard from a separate file, named by `shard_path`.
+     *          The number of shards is defined by the `make` call, and must match the number of files.
+     *  @param[in] path The common prefix of the shard files.
+     *  @param[in] executor Thread-pool to load the shards in parallel.
+     *  @return Outcome descriptor explicitly convertible to boolean.
+     */
+    template <typename executor_at = dummy_executor_t>
+    serialization_result_t load(char const* path, executor_at&& executor = executor_at{}) {
+        return for_each_shard_file_(shards_, path, executor, [](shard_t& shard, char const* shard_path) {
+            return shard.load(shard_path);
+        });
+    }
+
+    /**
+     *  @brief  Memory-maps every shard from a separate file, named by `shard_path`.
+     *  @param[in] path The common prefix of the shard files.
+     *  @param[in] executor Thread-pool to map the shards in parallel.
+     *  @return Outcome descriptor explicitly convertible to boolean.
+     */
+    template <typename executor_at = dummy_executor_t>
+    serialization_result_t view(char const* path, executor_at&& executor = executor_at{}) {
+        return for_each_shard_file_(shards_, path, executor, [](shard_t& shard, char const* shard_path) {
+            return shard.view(shard_path);
+        });
+    }
+
+  private:
+    /// @brief Applies the ::callback to every shard and its file path, propagating the first error.
+    template <typename shards_at, typename executor_at, typename callback_at>
+    static serialization_result_t for_each_shard_file_( //
+        shards_at& shards, char const* path, executor_at& executor, callback_at&& callback) {
+
+        serialization_result_t result;
+        std::atomic<char const*> atomic_error{nullptr};
+        executor.dynamic(shards.size(), [&](std::size_t, std::size_t shard) {
+            std::string shard_path = index_sharded_gt::shard_path(path, shard);
+            serialization_result_t shard_result = callback(shards[shard], shard_path.c_str());
+            if (!shard_result) {
+                atomic_error = shard_result.error.release();
+                return false;
+            }
+            return true;
+        });
+        if (atomic_error)
+            return result.failed(atomic_error.load());
+        return result;
+    }
+};
+
+using index_sharded_t = index_sharded_gt<>;
+
+} // namespace usearch
+} // namespace unum
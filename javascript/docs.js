@@ -12,6 +12,20 @@ class Matches {
     }
 }
 
+/** Search result object for a batch of queries. */
+class BatchMatches {
+    /**
+     * @param {BigUint64Array} keys - The keys of the nearest neighbors found, size n*k.
+     * @param {Float32Array} distances - The distances of the nearest neighbors found, size n*k.
+     * @param {BigUint64Array} counts - The count of nearest neighbors found for every query.
+     */
+    constructor(keys, distances, counts) {
+        this.keys = keys;
+        this.distances = distances;
+        this.counts = counts;
+    }
+}
+
 /** K-Approximate Nearest Neighbors search index. */
 class Index {
     /**
@@ -95,6 +109,28 @@ class Index {
      */
     search(mat, k) {}
 
+    /** 
+     * Add n vectors of dimension d to the index on a background thread.
+     * The inputs are read in place, so they must not be modified until the promise settles.
+     * Until then, `save`, `load` and `view` throw.
+     * 
+     * @param {bigint | BigUint64Array} keys Input identifiers for every vector.
+     * @param {Float32Array} mat Input matrix, matrix of size n * d.
+     * @return {Promise<void>} Resolved once all vectors are inserted.
+     */
+    addAsync(keys, mat) {}
+
+    /** 
+     * Query n vectors of dimension d on a background thread. Return at most k vectors for each.
+     * The inputs are read in place, so they must not be modified until the promise settles.
+     * Until then, `save`, `load` and `view` throw.
+     *
+     * @param {Float32Array} mat Input vectors to search, matrix of size n * d.
+     * @param {bigint} k The bigint of nearest neighbors to search for.
+     * @return {Promise<Matches | BatchMatches>} Matches for a single query, BatchMatches for several.
+     */
+    searchAsync(mat, k) {}
+
     /** 
      * Check if an entry is contained in the index.
      * 
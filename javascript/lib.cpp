@@ -37,10 +37,24 @@ class Index : public Napi::ObjectWrap<Index> {
 
     void Add(Napi::CallbackInfo const& ctx);
     Napi::Value Search(Napi::CallbackInfo const& ctx);
+    Napi::Value AddAsync(Napi::CallbackInfo const& ctx);
+    Napi::Value SearchAsync(Napi::CallbackInfo const& ctx);
     Napi::Value Remove(Napi::CallbackInfo const& ctx);
     Napi::Value Contains(Napi::CallbackInfo const& ctx);
 
+    bool Reserve(std::size_t additions);
+    bool ForbidPendingWorkers(Napi::Env env) const;
+
+    class AddWorker;
+    class SearchWorker;
+
     std::unique_ptr<index_dense_t> native_;
+
+    /// @brief Number of vectors in the scheduled `addAsync` batches, not yet inserted.
+    std::size_t pending_additions_ = 0;
+
+    /// @brief Number of scheduled `addAsync` and `searchAsync` calls, not yet settled.
+    std::size_t pending_workers_ = 0;
 };
 
 Napi::Object Index::Init(Napi::Env env, Napi::Object exports) {
@@ -53,6 +67,8 @@ Napi::Object Index::Init(Napi::Env env, Napi::Object exports) {
             InstanceMethod("connectivity", &Index::GetConnectivity),
             InstanceMethod("add", &Index::Add),
             InstanceMethod("search", &Index::Search),
+            InstanceMethod("addAsync", &Index::AddAsync),
+            InstanceMethod("searchAsync", &Index::SearchAsync),
             InstanceMethod("remove", &Index::Remove),
             InstanceMethod("contains", &Index::Contains),
             InstanceMethod("save", &Index::Save),
@@ -152,6 +168,9 @@ void Index::Save(Napi::CallbackInfo const& ctx) {
         return;
     }
 
+    if (!ForbidPendingWorkers(env))
+        return;
+
     try {
         std::string path = ctx[0].As<Napi::String>();
         auto result = native_->save(path.c_str());
@@ -172,6 +191,9 @@ void Index::Load(Napi::CallbackInfo const& ctx) {
         return;
     }
 
+    if (!ForbidPendingWorkers(env))
+        return;
+
     try {
         std::string path = ctx[0].As<Napi::String>();
         auto result = native_->load(path.c_str());
@@ -192,6 +214,9 @@ void Index::View(Napi::CallbackInfo const& ctx) {
         return;
     }
 
+    if (!ForbidPendingWorkers(env))
+        return;
+
     try {
         std::string path = ctx[0].As<Napi::String>();
         auto result = native_->view(path.c_str());
@@ -245,9 +270,8 @@ void Index::Add(Napi::CallbackInfo const& ctx) {
             return Napi::TypeError::New(env, "The number of keys must match the number of vectors")
                 .ThrowAsJavaScriptException();
 
-        if (native_->size() + length >= native_->capacity())
-            if (!native_->reserve(ceil2(native_->size() + length)))
-                return Napi::TypeError::New(env, "Out of memory!").ThrowAsJavaScriptException();
+        if (!Reserve(length))
+            return Napi::TypeError::New(env, "Out of memory!").ThrowAsJavaScriptException();
 
         for (std::size_t i = 0; i < length; i++) {
             Napi::Value key_js = keys_js[i];
@@ -256,8 +280,8 @@ void Index::Add(Napi::CallbackInfo const& ctx) {
         }
 
     } else if (ctx[0].IsBigInt() && ctx[1].IsTypedArray()) {
-        if (native_->size() + 1 >= native_->capacity())
-            native_->reserve(ceil2(native_->size() + 1));
+        if (!Reserve(1))
+            return Napi::TypeError::New(env, "Out of memory!").ThrowAsJavaScriptException();
         add(ctx[0].As<Napi::BigInt>(), ctx[1].As<Napi::Float32Array>());
     } else
         return Napi::TypeError::New(env, "Invalid argument type, expects integral key(s) and float vector(s)")
@@ -315,6 +339,225 @@ Napi::Value Index::Search(Napi::CallbackInfo const& ctx) {
     }
 }
 
+/**
+ *  @brief  Grows the capacity ahead of insertions, including the ones scheduled by `addAsync`.
+ *          Growing is safe while the asynchronous workers are inserting and searching.
+ */
+bool Index::Reserve(std::size_t additions) {
+    std::size_t needed = native_->size() + pending_additions_ + additions;
+    if (needed < native_->capacity())
+        return true;
+    return native_->reserve(ceil2(needed));
+}
+
+/**
+ *  @brief  Throws, if any `addAsync` or `searchAsync` call is still running on the libuv thread pool,
+ *          as those would be reading or inserting into the memory replaced by `load` and `view`.
+ */
+bool Index::ForbidPendingWorkers(Napi::Env env) const {
+    if (!pending_workers_)
+        return true;
+    Napi::Error::New(env, "Wait for the pending asynchronous operations to settle").ThrowAsJavaScriptException();
+    return false;
+}
+
+/**
+ *  @brief  Inserts a batch of vectors on the libuv thread pool, settling a Promise once done.
+ *          Reads the keys and vectors straight from the typed arrays, that are referenced
+ *          until completion, so they must not be modified in the meantime.
+ */
+class Index::AddWorker : public Napi::AsyncWorker {
+  public:
+    AddWorker(Napi::Env env, Index& index, Napi::TypedArrayOf<std::uint64_t> keys_js, Napi::Float32Array vectors_js)
+        : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)), index_(index),
+          index_js_(Napi::Persistent(index.Value())), keys_js_(Napi::Persistent(keys_js)),
+          vectors_js_(Napi::Persistent(vectors_js)), keys_(keys_js.Data()), vectors_(vectors_js.Data()),
+          count_(keys_js.ElementLength()), dimensions_(index.native_->dimensions()) {
+        index_.pending_additions_ += count_;
+        index_.pending_workers_++;
+    }
+
+    Napi::Promise Promise() const { return deferred_.Promise(); }
+
+  protected:
+    void Execute() override {
+        for (std::size_t i = 0; i != count_; ++i) {
+            auto result = index_.native_->add(keys_[i], vectors_ + i * dimensions_);
+            if (!result)
+                return SetError(result.error.release());
+        }
+    }
+
+    void OnOK() override {
+        index_.pending_additions_ -= count_;
+        index_.pending_workers_--;
+        deferred_.Resolve(Env().Undefined());
+    }
+
+    void OnError(Napi::Error const& error) override {
+        index_.pending_additions_ -= count_;
+        index_.pending_workers_--;
+        deferred_.Reject(error.Value());
+    }
+
+  private:
+    Napi::Promise::Deferred deferred_;
+    Index& index_;
+    Napi::ObjectReference index_js_;
+    Napi::Reference<Napi::TypedArrayOf<std::uint64_t>> keys_js_;
+    Napi::Reference<Napi::Float32Array> vectors_js_;
+    std::uint64_t const* keys_;
+    float const* vectors_;
+    std::size_t count_;
+    std::size_t dimensions_;
+};
+
+/**
+ *  @brief  Searches a batch of queries on the libuv thread pool, settling a Promise once done.
+ *          Results are written straight into the typed arrays, that are allocated upfront
+ *          and handed to JavaScript only on completion, so nothing is copied.
+ */
+class Index::SearchWorker : public Napi::AsyncWorker {
+  public:
+    SearchWorker(Napi::Env env, Index& index, Napi::Float32Array queries_js, std::size_t wanted, bool batch)
+        : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)), index_(index),
+          index_js_(Napi::Persistent(index.Value())), queries_js_(Napi::Persistent(queries_js)),
+          queries_(queries_js.Data()), dimensions_(index.native_->dimensions()),
+          count_(queries_js.ElementLength() / dimensions_), wanted_(wanted), batch_(batch) {
+
+        auto keys_js = Napi::TypedArrayOf<std::uint64_t>::New(env, count_ * wanted_);
+        auto distances_js = Napi::Float32Array::New(env, count_ * wanted_);
+        auto counts_js = Napi::TypedArrayOf<std::uint64_t>::New(env, count_);
+        keys_ = keys_js.Data();
+        distances_ = distances_js.Data();
+        counts_ = counts_js.Data();
+        keys_js_ = Napi::Persistent(keys_js);
+        distances_js_ = Napi::Persistent(distances_js);
+        counts_js_ = Napi::Persistent(counts_js);
+        index_.pending_workers_++;
+    }
+
+    Napi::Promise Promise() const { return deferred_.Promise(); }
+
+  protected:
+    void Execute() override {
+        for (std::size_t i = 0; i != count_; ++i) {
+            auto result = index_.native_->search(queries_ + i * dimensions_, wanted_);
+            if (!result)
+                return SetError(result.error.release());
+            counts_[i] = result.dump_to(keys_ + i * wanted_, distances_ + i * wanted_);
+        }
+    }
+
+    void OnOK() override {
+        index_.pending_workers_--;
+        Napi::Env env = Env();
+        Napi::Object result_js = Napi::Object::New(env);
+        result_js.Set("keys", keys_js_.Value());
+        result_js.Set("distances", distances_js_.Value());
+        if (batch_)
+            result_js.Set("counts", counts_js_.Value());
+        else
+            result_js.Set("count", Napi::BigInt::New(env, counts_[0]));
+        deferred_.Resolve(result_js);
+    }
+
+    void OnError(Napi::Error const& error) override {
+        index_.pending_workers_--;
+        deferred_.Reject(error.Value());
+    }
+
+  private:
+    Napi::Promise::Deferred deferred_;
+    Index& index_;
+    Napi::ObjectReference index_js_;
+    Napi::Reference<Napi::Float32Array> queries_js_;
+    Napi::Reference<Napi::TypedArrayOf<std::uint64_t>> keys_js_;
+    Napi::Reference<Napi::Float32Array> distances_js_;
+    Napi::Reference<Napi::TypedArrayOf<std::uint64_t>> counts_js_;
+    float const* queries_;
+    std::size_t dimensions_;
+    std::size_t count_;
+    std::size_t wanted_;
+    bool batch_;
+    std::uint64_t* keys_{};
+    float* distances_{};
+    std::uint64_t* counts_{};
+};
+
+Napi::Value Index::AddAsync(Napi::CallbackInfo const& ctx) {
+    Napi::Env env = ctx.Env();
+    if (ctx.Length() < 2 || !ctx[1].IsTypedArray() ||
+        ctx[1].As<Napi::TypedArray>().TypedArrayType() != napi_float32_array) {
+        Napi::TypeError::New(env, "Expects integral key(s) and a Float32Array of vectors").ThrowAsJavaScriptException();
+        return {};
+    }
+
+    // A single key is wrapped into an array, to be referenced by the worker like a batch
+    Napi::TypedArrayOf<std::uint64_t> keys_js;
+    if (ctx[0].IsBigInt()) {
+        bool lossless = true;
+        keys_js = Napi::TypedArrayOf<std::uint64_t>::New(env, 1);
+        keys_js[0] = ctx[0].As<Napi::BigInt>().Uint64Value(&lossless);
+        if (!lossless) {
+            Napi::TypeError::New(env, "Keys must be unsigned integers").ThrowAsJavaScriptException();
+            return {};
+        }
+    } else if (ctx[0].IsTypedArray() && ctx[0].As<Napi::TypedArray>().TypedArrayType() == napi_biguint64_array)
+        keys_js = ctx[0].As<Napi::TypedArrayOf<std::uint64_t>>();
+    else {
+        Napi::TypeError::New(env, "Keys must be a bigint or a BigUint64Array").ThrowAsJavaScriptException();
+        return {};
+    }
+
+    Napi::Float32Array vectors_js = ctx[1].As<Napi::Float32Array>();
+    if (vectors_js.ElementLength() != keys_js.ElementLength() * native_->dimensions()) {
+        Napi::TypeError::New(env, "The number of keys must match the number of vectors").ThrowAsJavaScriptException();
+        return {};
+    }
+
+    if (!Reserve(keys_js.ElementLength())) {
+        Napi::TypeError::New(env, "Out of memory!").ThrowAsJavaScriptException();
+        return {};
+    }
+
+    AddWorker* worker = new AddWorker(env, *this, keys_js, vectors_js);
+    Napi::Promise promise = worker->Promise();
+    worker->Queue();
+    return promise;
+}
+
+Napi::Value Index::SearchAsync(Napi::CallbackInfo const& ctx) {
+    Napi::Env env = ctx.Env();
+    if (ctx.Length() < 2 || !ctx[0].IsTypedArray() || !ctx[1].IsBigInt() ||
+        ctx[0].As<Napi::TypedArray>().TypedArrayType() != napi_float32_array) {
+        Napi::TypeError::New(env, "Expects a Float32Array of queries and the number of wanted results")
+            .ThrowAsJavaScriptException();
+        return {};
+    }
+
+    Napi::Float32Array queries_js = ctx[0].As<Napi::Float32Array>();
+    std::size_t dimensions = native_->dimensions();
+    std::size_t length = queries_js.ElementLength();
+    if (!length || length % dimensions) {
+        Napi::TypeError::New(env, "Wrong number of dimensions").ThrowAsJavaScriptException();
+        return {};
+    }
+
+    bool lossless = true;
+    std::uint64_t wanted = ctx[1].As<Napi::BigInt>().Uint64Value(&lossless);
+    if (!lossless) {
+        Napi::TypeError::New(env, "Wanted number of matches must be an unsigned integer").ThrowAsJavaScriptException();
+        return {};
+    }
+
+    // A matrix of several queries produces the results for all of them, concatenated
+    SearchWorker* worker = new SearchWorker(env, *this, queries_js, wanted, length != dimensions);
+    Napi::Promise promise = worker->Promise();
+    worker->Queue();
+    return promise;
+}
+
 Napi::Value Index::Remove(Napi::CallbackInfo const& ctx) {
     Napi::Env env = ctx.Env();
     if (ctx.Length() < 1 || !ctx[0].IsBigInt()) {
@@ -29,4 +29,35 @@ results = indexBatch.search(new Float32Array([13, 14]), 2n);
 assert.deepEqual(results.keys, new BigUint64Array([15n, 16n]), 'keys should be 15 and 16');
 assert.deepEqual(results.distances, new Float32Array([45, 130]), 'distances should be 45 and 130');
 
-console.log('JavaScript tests passed!');
+// Asynchronous operations
+
+async function testAsync() {
+    var indexAsync = new usearch.Index({ metric: 'l2sq', connectivity: 16n, dimensions: 2n });
+    await indexAsync.addAsync(15n, new Float32Array([10, 20]));
+    await Promise.all([
+        indexAsync.addAsync(new BigUint64Array([16n]), new Float32Array([10, 25])),
+        indexAsync.addAsync(new BigUint64Array([17n, 18n]), new Float32Array([100, 200, 100, 250])),
+    ]);
+    assert.equal(indexAsync.size(), 4n, 'size after adding asynchronously should be 4');
+
+    var results = await indexAsync.searchAsync(new Float32Array([13, 14]), 2n);
+    assert.deepEqual(results.keys, new BigUint64Array([15n, 16n]), 'keys should be 15 and 16');
+    assert.deepEqual(results.distances, new Float32Array([45, 130]), 'distances should be 45 and 130');
+    assert.equal(results.count, 2n, 'count should be 2');
+
+    var batch = await indexAsync.searchAsync(new Float32Array([13, 14, 100, 200]), 1n);
+    assert.deepEqual(batch.keys, new BigUint64Array([15n, 17n]), 'keys should be 15 and 17');
+    assert.deepEqual(batch.counts, new BigUint64Array([1n, 1n]), 'counts should be 1 and 1');
+
+    // Serialization is refused, while asynchronous operations are in flight
+    var pending = indexAsync.addAsync(21n, new Float32Array([1, 1]));
+    assert.throws(() => indexAsync.save('tmp.usearch'));
+    await pending;
+
+    assert.throws(() => indexAsync.addAsync(new BigUint64Array([19n, 20n]), new Float32Array([1, 2])), TypeError);
+}
+
+testAsync().then(() => console.log('JavaScript tests passed!'), (error) => {
+    console.error(error);
+    process.exit(1);
+});
@@ -9,6 +9,16 @@ export interface Matches {
     count: bigint
 }
 
+/** Search result object for a batch of queries. */
+export interface BatchMatches {
+    /** The keys of the nearest neighbors found, size n*k. */
+    keys: BigUint64Array,
+    /** The distances of the nearest neighbors found, size n*k. */
+    distances: Float32Array,
+    /** The number of nearest neighbors found for every query, size n. */
+    counts: BigUint64Array
+}
+
 /** K-Approximate Nearest Neighbors search index. */
 export class Index {
 
@@ -93,6 +103,28 @@ export class Index {
      */
     search(mat: Float32Array, k: bigint): Matches;
 
+    /** 
+     * Add n vectors of dimension d to the index on a background thread.
+     * The inputs are read in place, so they must not be modified until the promise settles.
+     * Until then, `save`, `load` and `view` throw.
+     * 
+     * @param {bigint | BigUint64Array} keys Input identifiers for every vector.
+     * @param {Float32Array} mat Input matrix, matrix of size n * d.
+     * @return {Promise<void>} Resolved once all vectors are inserted.
+     */
+    addAsync(keys: bigint | BigUint64Array, mat: Float32Array): Promise<void>;
+
+    /** 
+     * Query n vectors of dimension d on a background thread. Return at most k vectors for each.
+     * The inputs are read in place, so they must not be modified until the promise settles.
+     * Until then, `save`, `load` and `view` throw.
+     *
+     * @param {Float32Array} mat Input vectors to search, matrix of size n * d.
+     * @param {bigint} k The bigint of nearest neighbors to search for.
+     * @return {Promise<Matches | BatchMatches>} Matches for a single query, BatchMatches for several.
+     */
+    searchAsync(mat: Float32Array, k: bigint): Promise<Matches | BatchMatches>;
+
     /** 
      * Check if an entry is contained in the index.
      * 
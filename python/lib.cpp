@@ -16,8 +16,10 @@
 #define __cpp_exceptions 1
 #endif
 
-#include <limits> // `std::numeric_limits`
-#include <thread> // `std::thread`
+#include <limits>       // `std::numeric_limits`
+#include <mutex>        // `std::mutex`
+#include <shared_mutex> // `std::shared_mutex`
+#include <thread>       // `std::thread`
 
 #define _CRT_SECURE_NO_WARNINGS
 #define PY_SSIZE_T_CLEAN
@@ -63,11 +65,19 @@ struct dense_index_py_t : public index_dense_t {
     using native_t::search;
     using native_t::size;
 
+    /// @brief Shared by batches with leased thread IDs, exclusive for the rest, that replace memory or contexts.
+    mutable std::shared_mutex batch_mutex;
+
+    /// @brief Number of live NumPy arrays from `get_vectors_matrix`, borrowing the memory of the index.
+    std::size_t exported_views = 0;
+
     dense_index_py_t(native_t&& base) : index_dense_t(std::move(base)) {}
+    dense_index_py_t(dense_index_py_t&& other) : index_dense_t(std::move(other)) {}
 };
 
 struct dense_indexes_py_t {
     std::vector<std::shared_ptr<dense_index_py_t>> shards_;
+    mutable std::shared_mutex batch_mutex;
 
     void merge(std::shared_ptr<dense_index_py_t> shard) { shards_.push_back(shard); }
     std::size_t bytes_per_vector() const noexcept { return shards_.empty() ? 0 : shards_[0]->bytes_per_vector(); }
@@ -204,6 +214,113 @@ template <typename result_at> void forward_error(result_at&& result) {
 
 using atomic_error_t = std::atomic<char const*>;
 
+/**
+ *  @brief  Refuses to release the memory of the index, while NumPy arrays from `get_vectors_matrix` borrow it.
+ *          The counter is only touched with the GIL held, so no synchronization is needed.
+ */
+static void forbid_exported_views(dense_index_py_t const& index) {
+    if (index.exported_views)
+        throw std::runtime_error("Can't release the index memory, while `vectors_matrix` arrays reference it");
+}
+
+/**
+ *  @brief  Waits for the other batch operations on the same index to finish. The GIL is released while waiting,
+ *          as the running batch may need it to poll for signals.
+ */
+template <typename index_at> static std::unique_lock<std::shared_mutex> lock_batches(index_at const& index) {
+    py::gil_scoped_release released;
+    return std::unique_lock<std::shared_mutex>(index.batch_mutex);
+}
+
+/**
+ *  @brief  Enters a batch, that may run alongside other batches on the same index, once it fits `members`
+ *          and has contexts for every thread ID of the pool. Growing those is left to an exclusive lock,
+ *          as the contexts can't be reallocated under running searches. Expects the GIL to be released.
+ *  @return Lock that doesn't own the mutex, if the memory couldn't be reserved.
+ */
+static std::shared_lock<std::shared_mutex> try_share_batches(dense_index_py_t& index, std::size_t members) {
+    std::size_t const threads = std::thread::hardware_concurrency();
+    while (true) {
+        {
+            std::shared_lock<std::shared_mutex> lock(index.batch_mutex);
+            if (index.capacity() >= members && index.limits().threads() >= threads)
+                return lock;
+        }
+        std::unique_lock<std::shared_mutex> lock(index.batch_mutex);
+        if (!index.reserve(index_limits_t((std::max)(members, index.capacity()), threads)))
+            return {};
+    }
+}
+
+static std::shared_lock<std::shared_mutex> share_batches(dense_index_py_t& index) {
+    std::shared_lock<std::shared_mutex> lock;
+    {
+        py::gil_scoped_release released;
+        lock = try_share_batches(index, index.size());
+    }
+    if (!lock)
+        throw std::invalid_argument("Out of memory!");
+    return lock;
+}
+
+/**
+ *  @brief  Enters a batch over the shards, that each batch enters and reserves on its own.
+ */
+static std::shared_lock<std::shared_mutex> share_batches(dense_indexes_py_t& indexes) {
+    py::gil_scoped_release released;
+    return std::shared_lock<std::shared_mutex>(indexes.batch_mutex);
+}
+
+/**
+ *  @brief  Thread IDs of the index, leased for one batch. Concurrent batches get disjoint IDs,
+ *          so they share the thread contexts without waiting for each other to finish.
+ */
+class threads_lease_t {
+    dense_index_py_t const& index_;
+    std::vector<std::size_t> ids_;
+
+  public:
+    threads_lease_t(dense_index_py_t const& index, std::size_t count) : index_(index), ids_(count) {
+        bool leased;
+        {
+            py::gil_scoped_release released;
+            leased = index_.lease_threads(ids_.data(), ids_.size());
+        }
+        if (!leased)
+            throw std::invalid_argument("Can't use that many threads!");
+    }
+    ~threads_lease_t() { index_.release_threads(ids_.data(), ids_.size()); }
+    threads_lease_t(threads_lease_t const&) = delete;
+    threads_lease_t& operator=(threads_lease_t const&) = delete;
+
+    std::size_t operator[](std::size_t thread_idx) const noexcept { return ids_[thread_idx]; }
+};
+
+/**
+ *  @brief  Polls for Python signals, like `KeyboardInterrupt`, from the first thread of a batch, that runs
+ *          without the GIL. Reacquires the GIL only once in a while, so that other Python threads can progress.
+ */
+class signals_poller_t {
+    std::size_t polls_ = 0;
+    bool raised_ = false;
+
+  public:
+    /// @brief Returns `true` if the batch must be interrupted.
+    bool operator()(std::size_t thread_idx) {
+        if (thread_idx != 0 || polls_++ % 256 != 0)
+            return false;
+        py::gil_scoped_acquire acquired;
+        raised_ = PyErr_CheckSignals() != 0;
+        return raised_;
+    }
+
+    /// @brief Rethrows the exception of the signal handler. Must be called with the GIL held.
+    void raise() const {
+        if (raised_)
+            throw py::error_already_set();
+    }
+};
+
 template <typename scalar_at>
 static void add_typed_to_index(                                            //
     dense_index_py_t& index,                                               //
@@ -214,22 +331,23 @@ static void add_typed_to_index(                                            //
     byte_t const* vectors_data = reinterpret_cast<byte_t const*>(vectors_info.ptr);
     byte_t const* keys_data = reinterpret_cast<byte_t const*>(keys_info.ptr);
     atomic_error_t atomic_error{nullptr};
-
-    executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
-        dense_key_t key = *reinterpret_cast<dense_key_t const*>(keys_data + task_idx * keys_info.strides[0]);
-        scalar_at const* vector = reinterpret_cast<scalar_at const*>(vectors_data + task_idx * vectors_info.strides[0]);
-        dense_add_result_t result = index.add(key, vector, thread_idx, force_copy);
-        if (!result) {
-            atomic_error = result.error.release();
-            return false;
-        }
-
-        // We don't want to check for signals from multiple threads
-        if (thread_idx == 0)
-            if (PyErr_CheckSignals() != 0)
+    signals_poller_t signals;
+
+    {
+        py::gil_scoped_release released;
+        executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
+            dense_key_t key = *reinterpret_cast<dense_key_t const*>(keys_data + task_idx * keys_info.strides[0]);
+            scalar_at const* vector =
+                reinterpret_cast<scalar_at const*>(vectors_data + task_idx * vectors_info.strides[0]);
+            dense_add_result_t result = index.add(key, vector, thread_idx, force_copy);
+            if (!result) {
+                atomic_error = result.error.release();
                 return false;
-        return true;
-    });
+            }
+            return !signals(thread_idx);
+        });
+    }
+    signals.raise();
 
     // Raise the error from a single thread
     auto error = atomic_error.load();
@@ -267,6 +385,7 @@ static void add_many_to_index(                            //
 
     if (!threads)
         threads = std::thread::hardware_concurrency();
+    auto batch_lock = lock_batches(index);
     if (!index.reserve(index_limits_t(ceil2(index.size() + vectors_count), threads)))
         throw std::invalid_argument("Out of memory!");
 
@@ -296,32 +415,32 @@ static void search_typed(                                   //
     Py_ssize_t vectors_count = vectors_info.shape[0];
     byte_t const* vectors_data = reinterpret_cast<byte_t const*>(vectors_info.ptr);
 
-    if (!threads)
+    // Every thread of the batch needs an ID of its own, and the pool has as many as the hardware
+    if (!threads || threads > std::thread::hardware_concurrency())
         threads = std::thread::hardware_concurrency();
-    if (!index.reserve(index_limits_t(index.size(), threads)))
-        throw std::invalid_argument("Out of memory!");
+    threads_lease_t lease(index, threads);
 
     atomic_error_t atomic_error{nullptr};
-    executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
-        scalar_at const* vector = (scalar_at const*)(vectors_data + task_idx * vectors_info.strides[0]);
-        dense_search_result_t result = index.search(vector, wanted, thread_idx, exact);
-        if (!result) {
-            atomic_error = result.error.release();
-            return false;
-        }
-
-        counts_py1d(task_idx) =
-            static_cast<Py_ssize_t>(result.dump_to(&keys_py2d(task_idx, 0), &distances_py2d(task_idx, 0)));
+    signals_poller_t signals;
+    {
+        py::gil_scoped_release released;
+        executor_default_t{threads}.dynamic(vectors_count, [&](std::size_t thread_idx, std::size_t task_idx) {
+            scalar_at const* vector = (scalar_at const*)(vectors_data + task_idx * vectors_info.strides[0]);
+            dense_search_result_t result = index.search(vector, wanted, lease[thread_idx], exact);
+            if (!result) {
+                atomic_error = result.error.release();
+                return false;
+            }
 
-        stats_visited_members += result.visited_members;
-        stats_computed_distances += result.computed_distances;
+            counts_py1d(task_idx) =
+                static_cast<Py_ssize_t>(result.dump_to(&keys_py2d(task_idx, 0), &distances_py2d(task_idx, 0)));
 
-        // We don't want to check for signals from multiple threads
-        if (thread_idx == 0)
-            if (PyErr_CheckSignals() != 0)
-                return false;
-        return true;
-    });
+            stats_visited_members += result.visited_members;
+            stats_computed_distances += result.computed_distances;
+            return !signals(thread_idx);
+        });
+    }
+    signals.raise();
 
     // Raise the error from a single thread
     auto error = atomic_error.load();
@@ -355,45 +474,43 @@ static void search_typed(                                       //
         throw std::bad_alloc();
 
     atomic_error_t atomic_error{nullptr};
-    executor_default_t{threads}.dynamic(indexes.shards_.size(), [&](std::size_t thread_idx, std::size_t task_idx) {
-        dense_index_py_t& index = *indexes.shards_[task_idx].get();
-
-        index_limits_t limits;
-        limits.members = index.size();
-        limits.threads_add = 0;
-        limits.threads_search = 1;
-        if (!index.reserve(limits)) {
-            atomic_error = "Out of memory!";
-            return false;
-        }
-
-        for (std::size_t vector_idx = 0; vector_idx != static_cast<std::size_t>(vectors_count); ++vector_idx) {
-            scalar_at const* vector = (scalar_at const*)(vectors_data + vector_idx * vectors_info.strides[0]);
-            dense_search_result_t result = index.search(vector, wanted, 0, exact);
-            if (!result) {
-                atomic_error = result.error.release();
+    signals_poller_t signals;
+    {
+        py::gil_scoped_release released;
+        executor_default_t{threads}.dynamic(indexes.shards_.size(), [&](std::size_t thread_idx, std::size_t task_idx) {
+            dense_index_py_t& index = *indexes.shards_[task_idx].get();
+            std::shared_lock<std::shared_mutex> shard_lock = try_share_batches(index, index.size());
+            if (!shard_lock) {
+                atomic_error = "Out of memory!";
                 return false;
             }
 
-            {
-                auto lock = query_mutexes.lock(vector_idx);
-                counts_py1d(vector_idx) = static_cast<Py_ssize_t>(result.merge_into( //
-                    &keys_py2d(vector_idx, 0),                                       //
-                    &distances_py2d(vector_idx, 0),                                  //
-                    static_cast<std::size_t>(counts_py1d(vector_idx)),               //
-                    wanted));
-            }
-
-            stats_visited_members += result.visited_members;
-            stats_computed_distances += result.computed_distances;
-
-            // We don't want to check for signals from multiple threads
-            if (thread_idx == 0)
-                if (PyErr_CheckSignals() != 0)
+            for (std::size_t vector_idx = 0; vector_idx != static_cast<std::size_t>(vectors_count); ++vector_idx) {
+                scalar_at const* vector = (scalar_at const*)(vectors_data + vector_idx * vectors_info.strides[0]);
+                dense_search_result_t result = index.search(vector, wanted, index_dense_t::any_thread(), exact);
+                if (!result) {
+                    atomic_error = result.error.release();
+                    return false;
+                }
+
+                {
+                    auto lock = query_mutexes.lock(vector_idx);
+                    counts_py1d(vector_idx) = static_cast<Py_ssize_t>(result.merge_into( //
+                        &keys_py2d(vector_idx, 0),                                       //
+                        &distances_py2d(vector_idx, 0),                                  //
+                        static_cast<std::size_t>(counts_py1d(vector_idx)),               //
+                        wanted));
+                }
+
+                stats_visited_members += result.visited_members;
+                stats_computed_distances += result.computed_distances;
+                if (signals(thread_idx))
                     return false;
+            }
             return true;
-        }
-    });
+        });
+    }
+    signals.raise();
 
     // Raise the error from a single thread
     auto error = atomic_error.load();
@@ -403,9 +520,34 @@ static void search_typed(                                       //
     }
 }
 
+/**
+ *  @brief  Validates the caller-provided output array, or allocates a new one, if `None` was passed.
+ *          Checks the dtype without casting, so the results are never written into a temporary copy.
+ */
+template <typename scalar_at>
+static py::array_t<scalar_at> output_array(py::object const& output, std::vector<Py_ssize_t> const& shape) {
+    if (output.is_none())
+        return py::array_t<scalar_at>(shape);
+    if (!py::isinstance<py::array_t<scalar_at>>(output))
+        throw std::invalid_argument("Output array has a wrong type!");
+
+    auto array = py::reinterpret_borrow<py::array_t<scalar_at>>(output);
+    if (array.ndim() != static_cast<Py_ssize_t>(shape.size()))
+        throw std::invalid_argument("Output array has a wrong number of dimensions!");
+    for (std::size_t i = 0; i != shape.size(); ++i)
+        if (array.shape(i) != shape[i])
+            throw std::invalid_argument("Output array has a wrong shape!");
+    if (!array.writeable())
+        throw std::invalid_argument("Output array is read-only!");
+    return array;
+}
+
 /**
  *  @param vectors Matrix of vectors to search for.
  *  @param wanted Number of matches per request.
+ *  @param out_keys Optional preallocated matrix for the neighbors, to avoid allocations.
+ *  @param out_distances Optional preallocated matrix for the distances.
+ *  @param out_counts Optional preallocated array for the match counts.
  *
  *  @return Tuple with:
  *      1. matrix of neighbors,
@@ -415,8 +557,9 @@ static void search_typed(                                       //
  *      4. number of computed pairwise distances.
  */
 template <typename index_at>
-static py::tuple search_many_in_index( //
-    index_at& index, py::buffer vectors, std::size_t wanted, bool exact, std::size_t threads) {
+static py::tuple search_many_in_index(                                                    //
+    index_at& index, py::buffer vectors, std::size_t wanted, bool exact, std::size_t threads, //
+    py::object out_keys, py::object out_distances, py::object out_counts) {
 
     if (wanted == 0)
         return py::tuple(5);
@@ -433,11 +576,13 @@ static py::tuple search_many_in_index( //
     if (vectors_dimensions != static_cast<Py_ssize_t>(index.scalar_words()))
         throw std::invalid_argument("The number of vector dimensions doesn't match!");
 
-    py::array_t<dense_key_t> keys_py({vectors_count, static_cast<Py_ssize_t>(wanted)});
-    py::array_t<distance_t> distances_py({vectors_count, static_cast<Py_ssize_t>(wanted)});
-    py::array_t<Py_ssize_t> counts_py(vectors_count);
+    Py_ssize_t wanted_count = static_cast<Py_ssize_t>(wanted);
+    py::array_t<dense_key_t> keys_py = output_array<dense_key_t>(out_keys, {vectors_count, wanted_count});
+    py::array_t<distance_t> distances_py = output_array<distance_t>(out_distances, {vectors_count, wanted_count});
+    py::array_t<Py_ssize_t> counts_py = output_array<Py_ssize_t>(out_counts, {vectors_count});
     std::atomic<std::size_t> stats_visited_members(0);
     std::atomic<std::size_t> stats_computed_distances(0);
+    auto batch_lock = share_batches(index);
 
     // clang-format off
     switch (numpy_string_to_kind(vectors_info.format)) {
@@ -485,40 +630,40 @@ static void search_typed_brute_force(                                //
     if (!query_mutexes)
         throw std::bad_alloc();
 
-    executor_default_t{threads}.dynamic(tasks_count, [&](std::size_t thread_idx, std::size_t task_idx) {
-        //
-        std::size_t dataset_idx = task_idx / queries_count;
-        std::size_t query_idx = task_idx % queries_count;
-
-        byte_t const* dataset = dataset_data + dataset_idx * dataset_info.strides[0];
-        byte_t const* query = queries_data + query_idx * queries_info.strides[0];
-        distance_t distance = metric(dataset, query);
+    signals_poller_t signals;
+    {
+        py::gil_scoped_release released;
+        executor_default_t{threads}.dynamic(tasks_count, [&](std::size_t thread_idx, std::size_t task_idx) {
+            //
+            std::size_t dataset_idx = task_idx / queries_count;
+            std::size_t query_idx = task_idx % queries_count;
 
-        {
-            auto lock = query_mutexes.lock(query_idx);
-            dense_key_t* keys = &keys_py2d(query_idx, 0);
-            distance_t* distances = &distances_py2d(query_idx, 0);
-            std::size_t& matches = reinterpret_cast<std::size_t&>(counts_py1d(query_idx));
-            if (matches == wanted)
-                if (distances[wanted - 1] <= distance)
-                    return true;
-
-            std::size_t offset = std::lower_bound(distances, distances + matches, distance) - distances;
-
-            std::size_t count_worse = matches - offset - (wanted == matches);
-            std::memmove(keys + offset + 1, keys + offset, count_worse * sizeof(dense_key_t));
-            std::memmove(distances + offset + 1, distances + offset, count_worse * sizeof(distance_t));
-            keys[offset] = static_cast<dense_key_t>(dataset_idx);
-            distances[offset] = distance;
-            matches += matches != wanted;
-        }
+            byte_t const* dataset = dataset_data + dataset_idx * dataset_info.strides[0];
+            byte_t const* query = queries_data + query_idx * queries_info.strides[0];
+            distance_t distance = metric(dataset, query);
 
-        // We don't want to check for signals from multiple threads
-        if (thread_idx == 0)
-            if (PyErr_CheckSignals() != 0)
-                return false;
-        return true;
-    });
+            {
+                auto lock = query_mutexes.lock(query_idx);
+                dense_key_t* keys = &keys_py2d(query_idx, 0);
+                distance_t* distances = &distances_py2d(query_idx, 0);
+                std::size_t& matches = reinterpret_cast<std::size_t&>(counts_py1d(query_idx));
+                if (matches == wanted)
+                    if (distances[wanted - 1] <= distance)
+                        return true;
+
+                std::size_t offset = std::lower_bound(distances, distances + matches, distance) - distances;
+
+                std::size_t count_worse = matches - offset - (wanted == matches);
+                std::memmove(keys + offset + 1, keys + offset, count_worse * sizeof(dense_key_t));
+                std::memmove(distances + offset + 1, distances + offset, count_worse * sizeof(distance_t));
+                keys[offset] = static_cast<dense_key_t>(dataset_idx);
+                distances[offset] = distance;
+                matches += matches != wanted;
+            }
+            return !signals(thread_idx);
+        });
+    }
+    signals.raise();
 }
 
 static py::tuple search_many_brute_force(    //
@@ -634,16 +779,23 @@ static py::tuple cluster_vectors(        //
 
     rows_lookup_gt<byte_t const> queries_begin(queries_info.ptr, queries_stride);
     rows_lookup_gt<byte_t const> queries_end = queries_begin + queries_count;
+    scalar_kind_t queries_kind = numpy_string_to_kind(queries_info.format);
+    auto batch_lock = lock_batches(index);
 
     // clang-format off
-    switch (numpy_string_to_kind(queries_info.format)) {
-    case scalar_kind_t::b1x8_k: cluster_result = index.cluster(queries_begin.as<b1x8_t const>(), queries_end.as<b1x8_t const>(), config, keys_ptr, distances_ptr, executor); break;
-    case scalar_kind_t::i8_k: cluster_result = index.cluster(queries_begin.as<i8_bits_t const>(), queries_end.as<i8_bits_t const>(), config, keys_ptr, distances_ptr, executor); break;
-    case scalar_kind_t::f16_k: cluster_result = index.cluster(queries_begin.as<f16_t const>(), queries_end.as<f16_t const>(), config, keys_ptr, distances_ptr, executor); break;
-    case scalar_kind_t::f32_k: cluster_result = index.cluster(queries_begin.as<f32_t const>(), queries_end.as<f32_t const>(), config, keys_ptr, distances_ptr, executor); break;
-    case scalar_kind_t::f64_k: cluster_result = index.cluster(queries_begin.as<f64_t const>(), queries_end.as<f64_t const>(), config, keys_ptr, distances_ptr, executor); break;
-    default: throw std::invalid_argument("Incompatible scalars in the query matrix: " + queries_info.format);
+    {
+        py::gil_scoped_release released;
+        switch (queries_kind) {
+        case scalar_kind_t::b1x8_k: cluster_result = index.cluster(queries_begin.as<b1x8_t const>(), queries_end.as<b1x8_t const>(), config, keys_ptr, distances_ptr, executor); break;
+        case scalar_kind_t::i8_k: cluster_result = index.cluster(queries_begin.as<i8_bits_t const>(), queries_end.as<i8_bits_t const>(), config, keys_ptr, distances_ptr, executor); break;
+        case scalar_kind_t::f16_k: cluster_result = index.cluster(queries_begin.as<f16_t const>(), queries_end.as<f16_t const>(), config, keys_ptr, distances_ptr, executor); break;
+        case scalar_kind_t::f32_k: cluster_result = index.cluster(queries_begin.as<f32_t const>(), queries_end.as<f32_t const>(), config, keys_ptr, distances_ptr, executor); break;
+        case scalar_kind_t::f64_k: cluster_result = index.cluster(queries_begin.as<f64_t const>(), queries_end.as<f64_t const>(), config, keys_ptr, distances_ptr, executor); break;
+        default: break;
+        }
     }
+    if (queries_kind == scalar_kind_t::unknown_k)
+        throw std::invalid_argument("Incompatible scalars in the query matrix: " + queries_info.format);
     // clang-format on
 
     cluster_result.error.raise();
@@ -700,8 +852,12 @@ static py::tuple cluster_keys(                            //
     config.min_clusters = min_count;
     config.max_clusters = max_count;
 
-    dense_clustering_result_t cluster_result =
-        index.cluster(queries_begin, queries_end, config, keys_ptr, distances_ptr, executor);
+    dense_clustering_result_t cluster_result;
+    {
+        auto batch_lock = lock_batches(index);
+        py::gil_scoped_release released;
+        cluster_result = index.cluster(queries_begin, queries_end, config, keys_ptr, distances_ptr, executor);
+    }
     cluster_result.error.raise();
 
     // Those would be set to 1 for all entries, in case of success
@@ -733,7 +889,17 @@ static std::unordered_map<dense_key_t, dense_key_t> join_index( //
     config.expansion = (std::max)(a.expansion_search(), b.expansion_search());
     std::size_t threads = (std::min)(a.limits().threads(), b.limits().threads());
     executor_default_t executor{threads};
-    join_result_t result = a.join(b, config, a_to_b, b_to_a, executor);
+    join_result_t result;
+    {
+        py::gil_scoped_release released;
+        std::unique_lock<std::shared_mutex> a_lock(a.batch_mutex, std::defer_lock);
+        std::unique_lock<std::shared_mutex> b_lock(b.batch_mutex, std::defer_lock);
+        if (&a == &b)
+            a_lock.lock();
+        else
+            std::lock(a_lock, b_lock);
+        result = a.join(b, config, a_to_b, b_to_a, executor);
+    }
     forward_error(result);
 
     return a_to_b;
@@ -751,20 +917,23 @@ static dense_index_py_t copy_index(dense_index_py_t const& index, bool force_cop
 
 static void compact_index(dense_index_py_t& index, std::size_t threads) {
 
+    forbid_exported_views(index);
     if (!threads)
         threads = std::thread::hardware_concurrency();
+    auto batch_lock = lock_batches(index);
     if (!index.reserve(index_limits_t(index.size(), threads)))
         throw std::invalid_argument("Out of memory!");
 
+    py::gil_scoped_release released;
     index.compact(executor_default_t{threads});
 }
 
 // clang-format off
-template <typename index_at> void save_index(index_at const& index, std::string const& path) { index.save(path.c_str()).error.raise(); }
-template <typename index_at> void load_index(index_at& index, std::string const& path) { index.load(path.c_str()).error.raise(); }
-template <typename index_at> void view_index(index_at& index, std::string const& path) { index.view(path.c_str()).error.raise(); }
-template <typename index_at> void reset_index(index_at& index) { index.reset(); }
-template <typename index_at> void clear_index(index_at& index) { index.clear(); }
+template <typename index_at> void save_index(index_at const& index, std::string const& path) { auto batch_lock = lock_batches(index); index.save(path.c_str()).error.raise(); }
+template <typename index_at> void load_index(index_at& index, std::string const& path) { forbid_exported_views(index); auto batch_lock = lock_batches(index); index.load(path.c_str()).error.raise(); }
+template <typename index_at> void view_index(index_at& index, std::string const& path) { forbid_exported_views(index); auto batch_lock = lock_batches(index); index.view(path.c_str()).error.raise(); }
+template <typename index_at> void reset_index(index_at& index) { forbid_exported_views(index); auto batch_lock = lock_batches(index); index.reset(); }
+template <typename index_at> void clear_index(index_at& index) { forbid_exported_views(index); auto batch_lock = lock_batches(index); index.clear(); }
 template <typename index_at> std::size_t max_level(index_at const &index) { return index.max_level(); }
 template <typename index_at> typename index_at::stats_t compute_stats(index_at const &index) { return index.stats(); }
 template <typename index_at> typename index_at::stats_t compute_level_stats(index_at const &index, std::size_t level) { return index.stats(level); }
@@ -931,7 +1100,10 @@ PYBIND11_MODULE(compiled, m) {
         py::arg("queries"),                                     //
         py::arg("count") = 10,                                  //
         py::arg("exact") = false,                               //
-        py::arg("threads") = 0                                  //
+        py::arg("threads") = 0,                                 //
+        py::arg("out_keys") = py::none(),                       //
+        py::arg("out_distances") = py::none(),                  //
+        py::arg("out_counts") = py::none()                      //
     );
 
     i.def(                                                     //
@@ -999,9 +1171,11 @@ PYBIND11_MODULE(compiled, m) {
 
             if (!threads)
                 threads = std::thread::hardware_concurrency();
+            auto batch_lock = lock_batches(index);
             if (!index.reserve(index_limits_t(index.size(), threads)))
                 throw std::invalid_argument("Out of memory!");
 
+            py::gil_scoped_release released;
             index.isolate(executor_default_t{threads});
             return result.completed;
         },
@@ -1018,9 +1192,11 @@ PYBIND11_MODULE(compiled, m) {
 
             if (!threads)
                 threads = std::thread::hardware_concurrency();
+            auto batch_lock = lock_batches(index);
             if (!index.reserve(index_limits_t(index.size(), threads)))
                 throw std::invalid_argument("Out of memory!");
 
+            py::gil_scoped_release released;
             index.isolate(executor_default_t{threads});
             return result.completed;
         },
@@ -1036,6 +1212,7 @@ PYBIND11_MODULE(compiled, m) {
         "dtype", [](dense_index_py_t const& index) -> scalar_kind_t { return index.scalar_kind(); });
     i.def_property_readonly( //
         "memory_usage", [](dense_index_py_t const& index) -> std::size_t { return index.memory_usage(); });
+    i.def_property_readonly("memory_stats", &dense_index_py_t::memory_stats);
 
     i.def_property("expansion_add", &dense_index_py_t::expansion_add, &dense_index_py_t::change_expansion_add);
     i.def_property("expansion_search", &dense_index_py_t::expansion_search, &dense_index_py_t::change_expansion_search);
@@ -1106,6 +1283,49 @@ PYBIND11_MODULE(compiled, m) {
 
     i.def("get_many", &get_many<dense_index_py_t>, py::arg("keys"), py::arg("dtype") = scalar_kind_t::f32_k);
 
+    i.def( //
+        "rows_of_many",
+        [](dense_index_py_t const& index, py::array_t<dense_key_t> const& keys_py) -> py::array_t<Py_ssize_t> {
+            py::array_t<Py_ssize_t> results_py(keys_py.size());
+            auto results_py1d = results_py.template mutable_unchecked<1>();
+            auto keys_py1d = keys_py.template unchecked<1>();
+            for (Py_ssize_t task_idx = 0; task_idx != keys_py.size(); ++task_idx) {
+                dense_index_py_t::compressed_slot_t slot;
+                results_py1d(task_idx) =
+                    index.slot_of(keys_py1d(task_idx), slot) ? static_cast<Py_ssize_t>(slot) : Py_ssize_t(-1);
+            }
+            return results_py;
+        });
+
+    // Exposes the memory of a loaded or viewed index, without letting the array modify it. The array base
+    // keeps the `owner` and the index alive, and blocks the calls releasing that memory, until collected.
+    i.def(
+        "get_vectors_matrix",
+        [](std::shared_ptr<dense_index_py_t> const& index, py::object owner) -> py::object {
+            span_gt<byte_t const> matrix = index->vectors_matrix();
+            if (!matrix.size())
+                return py::none();
+
+            struct exported_view_t {
+                std::shared_ptr<dense_index_py_t> index;
+                py::object owner;
+            };
+            py::capsule base(new exported_view_t{index, std::move(owner)}, [](void* view_ptr) {
+                exported_view_t* view = static_cast<exported_view_t*>(view_ptr);
+                --view->index->exported_views;
+                delete view;
+            });
+            ++index->exported_views;
+
+            Py_ssize_t columns = static_cast<Py_ssize_t>(index->bytes_per_vector());
+            Py_ssize_t rows = static_cast<Py_ssize_t>(matrix.size()) / columns;
+            py::array_t<std::uint8_t> result_py({rows, columns}, {columns, Py_ssize_t(1)},
+                                                reinterpret_cast<std::uint8_t const*>(matrix.data()), base);
+            py::detail::array_proxy(result_py.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+            return result_py;
+        },
+        py::arg("owner"));
+
     i.def(
         "get_keys_in_slice",
         [](dense_index_py_t const& index, std::size_t offset, std::size_t limit) -> py::array_t<dense_key_t> {
@@ -1158,6 +1378,33 @@ PYBIND11_MODULE(compiled, m) {
     i.def_property_readonly("levels_stats", &compute_stats<dense_index_py_t>);
     i.def("level_stats", &compute_level_stats<dense_index_py_t>, py::arg("level"));
 
+    auto i_memory_stats = py::class_<index_dense_memory_stats_t>(m, "IndexMemoryStats");
+    i_memory_stats.def_readonly("graph", &index_dense_memory_stats_t::graph);
+    i_memory_stats.def_readonly("slots", &index_dense_memory_stats_t::slots);
+    i_memory_stats.def_readonly("vectors", &index_dense_memory_stats_t::vectors);
+    i_memory_stats.def_readonly("keys", &index_dense_memory_stats_t::keys);
+    i_memory_stats.def_readonly("contexts", &index_dense_memory_stats_t::contexts);
+    i_memory_stats.def_readonly("cache", &index_dense_memory_stats_t::cache);
+    i_memory_stats.def_readonly("arenas_wasted", &index_dense_memory_stats_t::arenas_wasted);
+    i_memory_stats.def_readonly("arenas_reserved", &index_dense_memory_stats_t::arenas_reserved);
+    i_memory_stats.def_property_readonly("total", &index_dense_memory_stats_t::total);
+
+    auto i_search_stats = py::class_<index_search_stats_t>(m, "IndexSearchStats");
+    i_search_stats.def_readonly("searches", &index_search_stats_t::searches);
+    i_search_stats.def_readonly("computed_distances", &index_search_stats_t::computed_distances);
+    i_search_stats.def_readonly("visited_members", &index_search_stats_t::visited_members);
+    i_search_stats.def_readonly("visits", &index_search_stats_t::visits);
+    i_search_stats.def_readonly("next_candidates", &index_search_stats_t::next_candidates);
+    i_search_stats.def_readonly("top_candidates", &index_search_stats_t::top_candidates);
+    i_search_stats.def_readonly("rejected_members", &index_search_stats_t::rejected_members);
+    i_search_stats.def_readonly("lock_spins", &index_search_stats_t::lock_spins);
+    i_search_stats.def_readonly("cast_nanoseconds", &index_search_stats_t::cast_nanoseconds);
+
+    i.def_property("collect_search_stats", &dense_index_py_t::search_stats_enabled,
+                   &dense_index_py_t::enable_search_stats);
+    i.def_property_readonly("search_stats", &dense_index_py_t::search_stats);
+    i.def("reset_search_stats", &dense_index_py_t::reset_search_stats);
+
     auto is = py::class_<dense_indexes_py_t>(m, "Indexes");
     is.def(py::init());
     is.def("__len__", &dense_indexes_py_t::size);
@@ -1169,6 +1416,9 @@ PYBIND11_MODULE(compiled, m) {
         py::arg("query"),                                         //
         py::arg("count") = 10,                                    //
         py::arg("exact") = false,                                 //
-        py::arg("threads") = 0                                    //
+        py::arg("threads") = 0,                                   //
+        py::arg("out_keys") = py::none(),                         //
+        py::arg("out_distances") = py::none(),                    //
+        py::arg("out_counts") = py::none()                        //
     );
 }
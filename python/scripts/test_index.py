@@ -1,4 +1,5 @@
 import os
+import asyncio
 
 import pytest
 import numpy as np
@@ -130,6 +131,97 @@ def test_index_stats(batch_size):
     assert index.level_stats(0).nodes == batch_size
 
 
+@pytest.mark.parametrize("batch_size", [1, 7, 1024])
+def test_index_async(batch_size):
+    ndim = 8
+    index = Index(ndim=ndim, multi=False)
+    keys = np.arange(batch_size)
+    vectors = random_vectors(count=batch_size, ndim=ndim)
+
+    async def pipeline():
+        await index.add_async(keys, vectors, threads=threads)
+        # Concurrent searches over the same index run together, on disjoint thread IDs
+        searches = [index.search_async(vectors, 10, threads=threads) for _ in range(4)]
+        return await asyncio.gather(*searches)
+
+    results = asyncio.run(pipeline())
+    expected = index.search(vectors, 10, threads=threads)
+    for matches in results:
+        assert np.array_equal(matches.keys, expected.keys)
+    assert len(index) == batch_size
+
+
+@pytest.mark.parametrize("batch_size", [1, 7, 1024])
+def test_index_search_into_arrays(batch_size):
+    ndim = 8
+    index = Index(ndim=ndim, multi=False)
+    keys = np.arange(batch_size)
+    vectors = random_vectors(count=batch_size, ndim=ndim)
+    index.add(keys, vectors, threads=threads)
+
+    # The same arrays are reused across searches, and the results reference them
+    out = (
+        np.zeros((batch_size, 10), dtype=np.uint64),
+        np.zeros((batch_size, 10), dtype=np.float32),
+        np.zeros(batch_size, dtype=np.intp),
+    )
+    for log_batch_size in [0, 3]:
+        matches = index.search(
+            vectors, 10, threads=threads, batch_size=log_batch_size, out=out
+        )
+        expected = index.search(vectors, 10, threads=threads)
+        assert np.shares_memory(matches.keys, out[0])
+        assert np.array_equal(out[0], expected.keys)
+        assert np.array_equal(out[2], expected.counts)
+
+    with pytest.raises(ValueError):
+        wrong_dtype = (out[0], out[1].astype(np.float64), out[2])
+        index.search(vectors, 10, out=wrong_dtype)
+    with pytest.raises(ValueError):
+        wrong_shape = (out[0][:, :5], out[1][:, :5], out[2])
+        index.search(vectors, 10, out=wrong_shape)
+
+
+@pytest.mark.parametrize("batch_size", [1, 7, 1024])
+@pytest.mark.parametrize("quantization", [ScalarKind.F32, ScalarKind.F16])
+def test_index_vectors_matrix(quantization, batch_size):
+    ndim = 8
+    index = Index(ndim=ndim, dtype=quantization, multi=False)
+    keys = np.arange(batch_size)
+    vectors = random_vectors(count=batch_size, ndim=ndim)
+    index.add(keys, vectors, threads=threads)
+    assert index.vectors_matrix is None
+    index.save("tmp.usearch")
+
+    for view in [False, True]:
+        restored = Index.restore("tmp.usearch", view=view)
+        matrix = restored.vectors_matrix
+        assert matrix.shape == (batch_size, ndim)
+        assert not matrix.flags.writeable
+        rows = restored.rows_of(keys)
+        expected = np.vstack(restored.get(keys))
+        assert np.array_equal(matrix[rows], expected)
+        assert restored.rows_of(batch_size) == -1
+
+        # The matrix blocks releasing the memory it references
+        for release in [restored.clear, restored.reset]:
+            with pytest.raises(RuntimeError):
+                release()
+
+        # The matrix keeps the index alive
+        del restored
+        assert np.array_equal(matrix[rows], expected)
+
+    # Once the matrix is collected, the memory can be released
+    restored = Index.restore("tmp.usearch")
+    matrix = restored.vectors_matrix
+    del matrix
+    restored.reset()
+    assert len(restored) == 0
+
+    os.remove("tmp.usearch")
+
+
 @pytest.mark.parametrize("ndim", [1, 3, 8, 32, 256, 4096])
 @pytest.mark.parametrize("batch_size", [1, 7, 1024])
 @pytest.mark.parametrize("quantization", [ScalarKind.F32, ScalarKind.I8])
@@ -0,0 +1,82 @@
+import time
+import socket
+import asyncio
+import threading
+
+import pytest
+import numpy as np
+
+from usearch.index import Index, Matches, BatchMatches
+from usearch.server import _serve
+from usearch.client import IndexClient
+from usearch.protocol import pack_head, unpack_head, Opcode
+
+
+ndim = 32
+dtypes = [np.float32, np.float16, np.float64, np.int8]
+
+
+def _free_port() -> int:
+    with socket.socket() as probe:
+        probe.bind(("127.0.0.1", 0))
+        return probe.getsockname()[1]
+
+
+@pytest.fixture(scope="module")
+def client():
+    index = Index(ndim=ndim, metric="l2sq")
+    port = _free_port()
+    thread = threading.Thread(
+        target=lambda: asyncio.run(_serve(index, "127.0.0.1", port, 1, False)),
+        daemon=True,
+    )
+    thread.start()
+
+    # Wait for the server to start listening
+    for _ in range(100):
+        try:
+            connection = IndexClient(port=port)
+            break
+        except ConnectionRefusedError:
+            time.sleep(0.05)
+    yield connection
+    connection.close()
+
+
+def test_protocol_head():
+    head = pack_head(100, 7, Opcode.SEARCH, dtype=1, rows=3, columns=4, count=5)
+    assert unpack_head(head) == (100, 7, Opcode.SEARCH, 1, 3, 4, 5)
+
+
+@pytest.mark.parametrize("dtype", dtypes)
+def test_client_server(client: IndexClient, dtype):
+    batch_size = 100
+    first_key = len(client)
+    keys = np.arange(first_key, first_key + batch_size)
+    if np.issubdtype(dtype, np.integer):
+        vectors = np.random.randint(-100, 100, size=(batch_size, ndim)).astype(dtype)
+    else:
+        vectors = np.random.rand(batch_size, ndim).astype(dtype)
+    client.add(keys, vectors)
+    assert len(client) == first_key + batch_size
+    assert client.ndim == ndim
+
+    matches: Matches = client.search(vectors[0], 10)
+    assert isinstance(matches, Matches)
+    assert matches.keys[0] == keys[0]
+
+    # Pipeline several batches over the same connection
+    batches = [vectors[i : i + 10] for i in range(0, batch_size, 10)]
+    for offset, batch_matches in enumerate(client.search_pipelined(batches, 10)):
+        assert isinstance(batch_matches, BatchMatches)
+        assert len(batch_matches) == 10
+        for row in range(10):
+            assert batch_matches.keys[row, 0] == keys[offset * 10 + row]
+
+
+def test_client_server_errors(client: IndexClient):
+    with pytest.raises(RuntimeError):
+        client.search(np.random.rand(ndim + 1).astype(np.float32), 10)
+
+    # The connection must remain usable after an error
+    assert client.ndim == ndim
@@ -1,111 +1,138 @@
-from typing import Union, Optional, List
+import socket
+from collections import deque
+from typing import Union, Iterable, Iterator, List
 
 import numpy as np
-from ucall.client import Client
 
-from usearch.index import Matches
-
-
-def _vector_to_ascii(vector: np.ndarray) -> Optional[str]:
-    if vector.dtype != np.int8 and vector.dtype != np.uint8 and vector.dtype != np.byte:
-        return None
-    if not np.all((vector >= 0) | (vector <= 100)):
-        return None
-
-    # Let's map [0, 100] to the range from [23, 123],
-    # poking 60 and replacing with the 124.
-    vector += 23
-    vector[vector == 60] = 124
-    ascii = str(vector)
-    return ascii
+from usearch.index import Matches, BatchMatches
+from usearch.protocol import (
+    HEAD,
+    STATS,
+    Key,
+    Opcode,
+    pack_head,
+    unpack_head,
+    vectors_payload,
+    matches_from_payload,
+)
 
 
 class IndexClient:
-    def __init__(
-        self, uri: str = "127.0.0.1", port: int = 8545, use_http: bool = True
-    ) -> None:
-        self.client = Client(uri=uri, port=port, use_http=use_http)
-
-    def add_one(self, key: int, vector: np.ndarray):
-        assert isinstance(key, int)
-        assert isinstance(vector, np.ndarray)
-        vector = vector.flatten()
-        ascii = _vector_to_ascii(vector)
-        if ascii:
-            self.client.add_ascii(key=key, string=ascii)
-        else:
-            self.client.add_one(key=key, vectors=vector)
-
-    def add_many(self, keys: np.ndarray, vectors: np.ndarray):
-        assert isinstance(keys, int)
-        assert isinstance(vectors, np.ndarray)
-        assert keys.ndim == 1 and vectors.ndim == 2
-        assert keys.shape[0] == vectors.shape[0]
-        self.client.add_many(keys=keys, vectors=vectors)
-
-    def add(self, keys: Union[np.ndarray, int], vectors: np.ndarray):
-        if isinstance(keys, int) or len(keys) == 1:
-            return self.add_one(keys, vectors)
-        else:
-            return self.add_many(keys, vectors)
-
-    def search_one(self, vector: np.ndarray, count: int) -> Matches:
-        matches: List[dict] = []
-        vector = vector.flatten()
-        ascii = _vector_to_ascii(vector)
-        if ascii:
-            matches = self.client.search_ascii(string=ascii, count=count)
-        else:
-            matches = self.client.search_one(vector=vector, count=count)
-
-        print(matches.data)
-        matches = matches.json
-
-        keys = np.array((1, count), dtype=np.uint32)
-        distances = np.array((1, count), dtype=np.float32)
-        counts = np.array((1), dtype=np.uint32)
-        for col, result in enumerate(matches):
-            keys[0, col] = result["key"]
-            distances[0, col] = result["distance"]
-        counts[0] = len(matches)
-
-        return keys, distances, counts
-
-    def search_many(self, vectors: np.ndarray, count: int) -> Matches:
-        batch_size: int = vectors.shape[0]
-        list_of_matches: List[List[dict]] = self.client.search_many(
-            vectors=vectors, count=count
+    """Client for `usearch.server`, speaking the binary protocol from `usearch.protocol`.
+
+    Requests can be pipelined: `search_pipelined` keeps up to `depth` batches
+    in flight on a single connection, hiding the network round-trips.
+    """
+
+    def __init__(self, uri: str = "127.0.0.1", port: int = 8545) -> None:
+        self.socket = socket.create_connection((uri, port))
+        self.socket.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.last_request_id = 0
+
+    def close(self):
+        self.socket.close()
+
+    def _send(self, opcode: Opcode, *chunks, **head) -> int:
+        self.last_request_id = (self.last_request_id + 1) & 0xFFFFFFFF
+        length = sum(len(chunk) for chunk in chunks)
+        self.socket.sendall(pack_head(length, self.last_request_id, opcode, **head))
+        for chunk in chunks:
+            self.socket.sendall(chunk)
+        return self.last_request_id
+
+    def _receive_exactly(self, length: int) -> memoryview:
+        buffer = bytearray(length)
+        view = memoryview(buffer)
+        received = 0
+        while received != length:
+            chunk = self.socket.recv_into(view[received:], length - received)
+            if chunk == 0:
+                raise ConnectionError("Server closed the connection")
+            received += chunk
+        return view
+
+    def _receive(self, request_id: int):
+        head = self._receive_exactly(HEAD.size)
+        length, response_id, opcode, _, rows, columns, _ = unpack_head(head)
+        payload = self._receive_exactly(length)
+        assert response_id == request_id, "Responses must arrive in order"
+        if opcode == Opcode.ERROR:
+            raise RuntimeError(bytes(payload).decode("utf-8"))
+        return opcode, rows, columns, payload
+
+    def _send_search(self, vectors: np.ndarray, count: int) -> int:
+        dtype, payload = vectors_payload(vectors)
+        rows = 1 if vectors.ndim == 1 else vectors.shape[0]
+        return self._send(
+            Opcode.SEARCH,
+            payload,
+            dtype=dtype,
+            rows=rows,
+            columns=vectors.shape[-1],
+            count=count,
         )
 
-        keys = np.array((batch_size, count), dtype=np.uint32)
-        distances = np.array((batch_size, count), dtype=np.float32)
-        counts = np.array((batch_size), dtype=np.uint32)
-        for row, matches in enumerate(list_of_matches):
-            for col, result in enumerate(matches):
-                keys[row, col] = result["key"]
-                distances[row, col] = result["distance"]
-            counts[row] = len(results)
+    def _receive_search(self, request_id: int) -> BatchMatches:
+        _, rows, columns, payload = self._receive(request_id)
+        keys, distances, counts = matches_from_payload(payload, rows, columns)
+        return BatchMatches(keys=keys, distances=distances, counts=counts)
 
-        return keys, distances, counts
-
-    def search(self, vectors: np.ndarray, count: int) -> Matches:
-        if vectors.ndim == 1 or (vectors.ndim == 2 and vectors.shape[0] == 1):
-            return self.search_one(vectors, count)
-        else:
-            return self.search_many(vectors, count)
+    def add(self, keys: Union[np.ndarray, int], vectors: np.ndarray):
+        if isinstance(keys, int):
+            keys = [keys]
+        keys = np.ascontiguousarray(keys, dtype=Key)
+        dtype, payload = vectors_payload(vectors)
+        assert len(keys) == (1 if vectors.ndim == 1 else vectors.shape[0])
+        request_id = self._send(
+            Opcode.ADD,
+            memoryview(keys).cast("B"),
+            payload,
+            dtype=dtype,
+            rows=len(keys),
+            columns=vectors.shape[-1],
+        )
+        self._receive(request_id)
+
+    def search(
+        self, vectors: np.ndarray, count: int = 10
+    ) -> Union[Matches, BatchMatches]:
+        batch = self._receive_search(self._send_search(vectors, count))
+        return batch[0] if vectors.ndim == 1 else batch
+
+    def search_pipelined(
+        self, batches: Iterable[np.ndarray], count: int = 10, depth: int = 8
+    ) -> Iterator[BatchMatches]:
+        """Searches many batches, keeping up to `depth` of them in flight.
+        Yields the results in the same order as the `batches`.
+
+        The server answers frames in order, so the in-flight responses should fit
+        into the socket buffers, or the two sides may wait on each other."""
+        in_flight = deque()
+        for vectors in batches:
+            in_flight.append(self._send_search(vectors, count))
+            if len(in_flight) == depth:
+                yield self._receive_search(in_flight.popleft())
+        while in_flight:
+            yield self._receive_search(in_flight.popleft())
+
+    def _stats(self) -> List[int]:
+        _, _, _, payload = self._receive(self._send(Opcode.STATS))
+        return list(STATS.unpack(payload))
 
     def __len__(self):
-        return self.client.size().json()
+        return self._stats()[0]
 
     @property
     def ndim(self):
-        return self.client.ndim().json()
+        return self._stats()[1]
 
+    @property
     def capacity(self):
-        return self.client.capacity().json()
+        return self._stats()[2]
 
+    @property
     def connectivity(self):
-        return self.client.connectivity().json()
+        return self._stats()[3]
 
     def load(self, path: str):
         raise NotImplementedError()
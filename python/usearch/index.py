@@ -6,6 +6,10 @@ from __future__ import annotations
 # into the primary `Index` class, connecting USearch with Numba.
 import os
 import math
+import asyncio
+import functools
+import threading
+from concurrent.futures import ThreadPoolExecutor
 from dataclasses import dataclass
 from typing import (
     Optional,
@@ -24,6 +28,8 @@ from tqdm import tqdm
 from usearch.compiled import Index as _CompiledIndex
 from usearch.compiled import Indexes as _CompiledIndexes
 from usearch.compiled import IndexStats as _CompiledIndexStats
+from usearch.compiled import IndexSearchStats as _CompiledIndexSearchStats
+from usearch.compiled import IndexMemoryStats as _CompiledIndexMemoryStats
 
 from usearch.compiled import index_dense_metadata as _index_dense_metadata
 from usearch.compiled import exact_search as _exact_search
@@ -128,12 +134,30 @@ def _normalize_metric(metric) -> MetricKind:
     return metric
 
 
+# The native batch operations release the GIL, so a few persistent threads are
+# enough to keep the indexes busy, while the event loop keeps serving other tasks.
+_async_executor: Optional[ThreadPoolExecutor] = None
+_async_executor_lock = threading.Lock()
+
+
+def _run_async(function: Callable, *args, **kwargs) -> asyncio.Future:
+    global _async_executor
+    with _async_executor_lock:
+        if _async_executor is None:
+            _async_executor = ThreadPoolExecutor(thread_name_prefix="usearch")
+    loop = asyncio.get_running_loop()
+    return loop.run_in_executor(
+        _async_executor, functools.partial(function, *args, **kwargs)
+    )
+
+
 def _search_in_compiled(
     compiled_callable: Callable,
     vectors: np.ndarray,
     *,
     log: Union[str, bool],
     batch_size: int,
+    out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]] = None,
     **kwargs,
 ) -> Union[Matches, BatchMatches]:
     #
@@ -143,6 +167,16 @@ def _search_in_compiled(
         vectors = vectors.reshape(1, len(vectors))
     count_vectors = vectors.shape[0]
 
+    def out_rows(start_row: int, stop_row: int) -> dict:
+        if out is None:
+            return {}
+        keys, distances, counts = out
+        return dict(
+            out_keys=keys[start_row:stop_row],
+            out_distances=distances[start_row:stop_row],
+            out_counts=counts[start_row:stop_row],
+        )
+
     def distil_batch(
         batch_matches: BatchMatches,
     ) -> Union[BatchMatches, Matches]:
@@ -165,24 +199,34 @@ def _search_in_compiled(
             unit="vector",
             disable=log is False,
         )
-        for vectors in tasks:
-            tuple_ = compiled_callable(vectors, **kwargs)
+        for start_row, vectors in zip(range(0, count_vectors, batch_size), tasks):
+            tuple_ = compiled_callable(
+                vectors, **kwargs, **out_rows(start_row, start_row + batch_size)
+            )
             tasks_matches.append(BatchMatches(*tuple_))
             pbar.update(vectors.shape[0])
 
         pbar.close()
+        visited_members = sum([m.visited_members for m in tasks_matches])
+        computed_distances = sum([m.computed_distances for m in tasks_matches])
+        if out is not None:
+            keys, distances, counts = out
+        else:
+            keys = np.vstack([m.keys for m in tasks_matches])
+            distances = np.vstack([m.distances for m in tasks_matches])
+            counts = np.concatenate([m.counts for m in tasks_matches], axis=None)
         return distil_batch(
             BatchMatches(
-                keys=np.vstack([m.keys for m in tasks_matches]),
-                distances=np.vstack([m.distances for m in tasks_matches]),
-                counts=np.concatenate([m.counts for m in tasks_matches], axis=None),
-                visited_members=sum([m.visited_members for m in tasks_matches]),
-                computed_distances=sum([m.computed_distances for m in tasks_matches]),
+                keys=keys,
+                distances=distances,
+                counts=counts,
+                visited_members=visited_members,
+                computed_distances=computed_distances,
             )
         )
 
     else:
-        tuple_ = compiled_callable(vectors, **kwargs)
+        tuple_ = compiled_callable(vectors, **kwargs, **out_rows(0, count_vectors))
         return distil_batch(BatchMatches(*tuple_))
 
 
@@ -644,6 +688,7 @@ class Index:
         exact: bool = False,
         log: Union[str, bool] = False,
         batch_size: int = 0,
+        out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]] = None,
     ) -> Union[Matches, BatchMatches]:
         """
         Performs approximate nearest neighbors search for one or more queries.
@@ -660,7 +705,11 @@ class Index:
         :type log: Union[str, bool], optional
         :param batch_size: Number of vectors to process at once
         :type batch_size: int, defaults to 0
-        :return: Matches for one or more queries
+        :param out: Preallocated `keys`, `distances` and `counts` arrays to fill,
+            shaped `(queries, count)`, `(queries, count)` and `(queries,)`,
+            with `Key`, `np.float32` and `np.intp` dtypes, to avoid allocations
+        :type out: Tuple[np.ndarray, np.ndarray, np.ndarray], optional
+        :return: Matches for one or more queries, referencing the `out` arrays, if passed
         :rtype: Union[Matches, BatchMatches]
         """
 
@@ -670,12 +719,48 @@ class Index:
             # Batch scheduling:
             log=log,
             batch_size=batch_size,
+            out=out,
             # Search constraints:
             count=count,
             exact=exact,
             threads=threads,
         )
 
+    async def add_async(
+        self,
+        keys: KeyOrKeysLike,
+        vectors: VectorOrVectorsLike,
+        *,
+        copy: bool = True,
+        threads: int = 0,
+    ) -> Union[int, np.ndarray]:
+        """Awaitable version of `add`, running on a persistent background thread.
+        The GIL is released during the insertions, so the event loop can serve
+        other tasks, like preparing the next batch.
+
+        With `copy=False`, the `vectors` must outlive the index, as with `add`.
+        Concurrent batches on the same index are executed one after another.
+        """
+        return await _run_async(self.add, keys, vectors, copy=copy, threads=threads)
+
+    async def search_async(
+        self,
+        vectors: VectorOrVectorsLike,
+        count: int = 10,
+        *,
+        threads: int = 0,
+        exact: bool = False,
+    ) -> Union[Matches, BatchMatches]:
+        """Awaitable version of `search`, running on a persistent background thread.
+        The GIL is released during the search, so the event loop can serve
+        other tasks, like answering HTTP requests.
+
+        Concurrent batches on the same index are executed one after another.
+        """
+        return await _run_async(
+            self.search, vectors, count, threads=threads, exact=exact
+        )
+
     def contains(self, keys: KeyOrKeysLike) -> Union[bool, np.ndarray]:
         if isinstance(keys, Iterable):
             return self._compiled.contains_many(np.array(keys, dtype=Key))
@@ -879,6 +964,27 @@ class Index:
     def memory_usage(self) -> int:
         return self._compiled.memory_usage
 
+    @property
+    def memory_stats(self) -> _CompiledIndexMemoryStats:
+        """Get the memory consumed by every component of the index, in bytes.
+        Memory-mapped files, opened with `view`, are not counted.
+
+        :return: Memory consumption, split by component.
+        :rtype: _CompiledIndexMemoryStats
+
+        Statistics:
+            - ``graph`` (int): The keys, levels and neighbors lists of the graph nodes.
+            - ``slots`` (int): The pointers to nodes and vectors, proportional to the capacity.
+            - ``vectors`` (int): The copies of the vectors, owned by the index.
+            - ``keys`` (int): The hash-table from keys to slots, and the free-list.
+            - ``contexts`` (int): The thread-local search and casting buffers.
+            - ``cache`` (int): The cache of the search results.
+            - ``arenas_wasted`` (int): The alignment padding and abandoned tails of the arenas.
+            - ``arenas_reserved`` (int): The unused remainder of the latest arenas.
+            - ``total`` (int): The sum of all the above, equal to ``memory_usage``.
+        """
+        return self._compiled.memory_stats
+
     @property
     def expansion_add(self) -> int:
         return self._compiled.expansion_add
@@ -1040,6 +1146,29 @@ class Index:
     def vectors(self) -> np.ndarray:
         return self.get(self.keys, vstack=True)
 
+    @property
+    def vectors_matrix(self) -> Optional[np.ndarray]:
+        """Read-only view of the vectors of a loaded or viewed index, without copies.
+        Every row is a stored vector, and `rows_of` maps keys to rows.
+        Returns `None`, if the vectors aren't stored contiguously, like in
+        an index built with `add`. Vectors added after `load` or `view` aren't
+        covered. While the array is referenced, `load`, `view`, `clear` and
+        `reset` raise a `RuntimeError`, instead of releasing its memory.
+        """
+        # The array references this object, so `__del__` can't reset the index under it
+        matrix = self._compiled.get_vectors_matrix(self)
+        if matrix is None:
+            return None
+        return matrix.view(_to_numpy_dtype(self.dtype))
+
+    def rows_of(self, keys: KeyOrKeysLike) -> Union[int, np.ndarray]:
+        """Finds the rows of `vectors_matrix` holding the vectors with given keys,
+        or -1 for missing keys. For multi-vector keys, any one of the rows is returned."""
+        if isinstance(keys, Iterable):
+            return self._compiled.rows_of_many(np.array(keys, dtype=Key))
+        else:
+            return int(self._compiled.rows_of_many(np.array([keys], dtype=Key))[0])
+
     @property
     def max_level(self) -> int:
         return self._compiled.max_level
@@ -1077,6 +1206,39 @@ class Index:
         """
         return self._compiled.level_stats(level)
 
+    @property
+    def collect_search_stats(self) -> bool:
+        """Whether every search accumulates the ``search_stats`` counters. Disabled by default."""
+        return self._compiled.collect_search_stats
+
+    @collect_search_stats.setter
+    def collect_search_stats(self, value: bool):
+        self._compiled.collect_search_stats = value
+
+    @property
+    def search_stats(self) -> _CompiledIndexSearchStats:
+        """Get the work done by all the searches since the counters were enabled or reset.
+        Counters are kept per thread, so the snapshot is approximate during concurrent searches.
+
+        :return: Counters accumulated across all threads.
+        :rtype: _CompiledIndexSearchStats
+
+        Statistics:
+            - ``searches`` (int): The number of searches, excluding cache hits.
+            - ``computed_distances`` (int): The number of distance computations.
+            - ``visited_members`` (int): The number of nodes, which neighbors were traversed.
+            - ``visits`` (int): The total size of the visited-sets.
+            - ``next_candidates`` (int): The total size of the unexplored candidates queues.
+            - ``top_candidates`` (int): The total size of the top candidates heaps.
+            - ``rejected_members`` (int): The number of candidates rejected by filters.
+            - ``lock_spins`` (int): The number of failed attempts to lock a node.
+            - ``cast_nanoseconds`` (int): The time spent converting queries to the index dtype.
+        """
+        return self._compiled.search_stats
+
+    def reset_search_stats(self):
+        self._compiled.reset_search_stats()
+
     @property
     def specs(self) -> Dict[str, Union[str, int, bool]]:
         return {
@@ -1165,6 +1327,7 @@ class Indexes:
         *,
         threads: int = 0,
         exact: bool = False,
+        out: Optional[Tuple[np.ndarray, np.ndarray, np.ndarray]] = None,
     ):
         return _search_in_compiled(
             self._compiled.search_many,
@@ -1172,6 +1335,7 @@ class Indexes:
             # Batch scheduling:
             log=False,
             batch_size=None,
+            out=out,
             # Search constraints:
             count=count,
             exact=exact,
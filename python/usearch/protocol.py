@@ -0,0 +1,105 @@
+"""
+Length-prefixed binary protocol, shared by `usearch.server` and `usearch.client`.
+
+Every frame starts with a fixed-size little-endian head, followed by `length` bytes of payload:
+
+    length: u32      - number of payload bytes following the head
+    request_id: u32  - echoed in the response, to match pipelined requests
+    opcode: u8       - one of `Opcode`, or `Opcode.ERROR` in failed responses
+    dtype: u8        - scalar type of the vectors in the payload, one of `DTYPE_CODES`
+    reserved: u16
+    rows: u32        - number of vectors in the batch
+    columns: u32     - number of scalars per vector, or of matches per query in responses
+    count: u32       - number of wanted matches per query, in search requests
+
+Payloads:
+
+    ADD request:     `rows` x u64 keys, then `rows x columns` vectors
+    SEARCH request:  `rows x columns` vectors
+    SEARCH response: `rows x columns` u64 keys, `rows x columns` f32 distances, `rows` i64 counts
+    STATS response:  4 x u64 - size, ndim, capacity, connectivity
+    ERROR response:  UTF-8 error message
+
+Vectors are transmitted as raw row-major matrices, so they can be wrapped
+with `np.frombuffer` and passed into the index without copies or parsing.
+"""
+import struct
+from enum import IntEnum
+from typing import Tuple
+
+import numpy as np
+
+Key = np.uint64
+
+HEAD = struct.Struct("<IIBBHIII")
+STATS = struct.Struct("<QQQQ")
+
+
+class Opcode(IntEnum):
+    ERROR = 0
+    ADD = 1
+    SEARCH = 2
+    STATS = 3
+
+
+DTYPE_CODES = {
+    np.dtype(np.float32): 1,
+    np.dtype(np.float16): 2,
+    np.dtype(np.int8): 3,
+    np.dtype(np.float64): 4,
+}
+CODE_DTYPES = {code: dtype for dtype, code in DTYPE_CODES.items()}
+
+
+def pack_head(
+    length: int,
+    request_id: int,
+    opcode: Opcode,
+    dtype: int = 0,
+    rows: int = 0,
+    columns: int = 0,
+    count: int = 0,
+) -> bytes:
+    return HEAD.pack(length, request_id, opcode, dtype, 0, rows, columns, count)
+
+
+def unpack_head(head: bytes) -> Tuple[int, int, Opcode, int, int, int, int]:
+    """Returns the `length, request_id, opcode, dtype, rows, columns, count` tuple."""
+    length, request_id, opcode, dtype, _, rows, columns, count = HEAD.unpack(head)
+    return length, request_id, Opcode(opcode), dtype, rows, columns, count
+
+
+def vectors_payload(vectors: np.ndarray) -> Tuple[int, memoryview]:
+    """Validates the matrix of vectors, returning its dtype code and a view of its bytes."""
+    if vectors.ndim == 1:
+        vectors = vectors.reshape(1, len(vectors))
+    assert vectors.ndim == 2, "Expects a matrix or vector"
+    code = DTYPE_CODES.get(vectors.dtype)
+    assert code is not None, f"Unsupported scalar type: {vectors.dtype}"
+    return code, memoryview(np.ascontiguousarray(vectors)).cast("B")
+
+
+def vectors_from_payload(
+    payload: memoryview, dtype: int, rows: int, columns: int
+) -> np.ndarray:
+    """Wraps the payload bytes into a matrix of vectors, without copies."""
+    return np.frombuffer(payload, dtype=CODE_DTYPES[dtype], count=rows * columns).reshape(
+        rows, columns
+    )
+
+
+def matches_from_payload(
+    payload: memoryview, rows: int, columns: int
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """Wraps the search response bytes into `keys`, `distances` and `counts` arrays, without copies."""
+    cells = rows * columns
+    keys_bytes = cells * np.dtype(Key).itemsize
+    distances_bytes = cells * np.dtype(np.float32).itemsize
+    keys = np.frombuffer(payload, dtype=Key, count=cells).reshape(rows, columns)
+    distances = np.frombuffer(
+        payload, dtype=np.float32, count=cells, offset=keys_bytes
+    ).reshape(rows, columns)
+    counts = np.frombuffer(
+        payload, dtype=np.int64, count=rows, offset=keys_bytes + distances_bytes
+    )
+    return keys, distances, counts
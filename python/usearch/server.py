@@ -2,38 +2,133 @@
 # -*- coding: utf-8 -*-
 
 import os
+import asyncio
 import argparse
-import numpy as np
-from typing import List
-
-from ucall.rich_posix import Server
-from usearch.index import Index, Matches, Key
+import functools
 
+import numpy as np
 
-def _ascii_to_vector(string: str) -> np.ndarray:
-    """
-    WARNING: A dirty performance hack!
-    Assuming the `i8` vectors in our implementations are just integers,
-    and generally contain scalars in the [0, 100] range, we can transmit
-    them as JSON-embedded strings. The only symbols we must avoid are
-    the double-quote '"' (code 22) and backslash '\' (code 60).
-    Printable ASCII characters are in [20, 126].
-    """
-    vector = np.array(string, dtype=np.int8)
-    vector[vector == 124] = 60
-    vector -= 23
-    return vector
+from usearch.index import Index, Key
+from usearch.protocol import (
+    HEAD,
+    STATS,
+    Opcode,
+    pack_head,
+    unpack_head,
+    vectors_from_payload,
+)
+
+
+async def _serve_connection(
+    index: Index,
+    threads: int,
+    immutable: bool,
+    reader: asyncio.StreamReader,
+    writer: asyncio.StreamWriter,
+):
+    """Answers the frames of one client in order, so that it can pipeline requests.
+    Batches run in the default executor without the GIL, so that other clients
+    are served while the index is busy."""
+    compiled = index._compiled
+    loop = asyncio.get_running_loop()
+    try:
+        while True:
+            try:
+                head = await reader.readexactly(HEAD.size)
+            except asyncio.IncompleteReadError:
+                break
+            length, request_id, opcode, dtype, rows, columns, count = unpack_head(head)
+            payload = memoryview(await reader.readexactly(length))
+
+            try:
+                if opcode == Opcode.SEARCH:
+                    # Query vectors are handed to the index without copies or parsing
+                    queries = vectors_from_payload(payload, dtype, rows, columns)
+                    keys, distances, counts, _, _ = await loop.run_in_executor(
+                        None,
+                        functools.partial(
+                            compiled.search_many,
+                            queries,
+                            count=count,
+                            exact=False,
+                            threads=threads,
+                        ),
+                    )
+                    counts = counts.astype(np.int64, copy=False)
+                    length = keys.nbytes + distances.nbytes + counts.nbytes
+                    writer.write(
+                        pack_head(length, request_id, opcode, rows=rows, columns=count)
+                    )
+                    writer.write(memoryview(keys).cast("B"))
+                    writer.write(memoryview(distances).cast("B"))
+                    writer.write(memoryview(counts).cast("B"))
+
+                elif opcode == Opcode.ADD:
+                    if immutable:
+                        raise ValueError("The index is immutable")
+                    keys_bytes = rows * np.dtype(Key).itemsize
+                    keys = np.frombuffer(payload, dtype=Key, count=rows)
+                    vectors = vectors_from_payload(
+                        payload[keys_bytes:], dtype, rows, columns
+                    )
+                    await loop.run_in_executor(
+                        None,
+                        functools.partial(
+                            compiled.add_many, keys, vectors, copy=True, threads=threads
+                        ),
+                    )
+                    writer.write(pack_head(0, request_id, opcode, rows=rows))
+
+                elif opcode == Opcode.STATS:
+                    stats = STATS.pack(
+                        len(index),
+                        index.ndim,
+                        index.capacity,
+                        index.connectivity,
+                    )
+                    writer.write(pack_head(len(stats), request_id, opcode))
+                    writer.write(stats)
+
+                else:
+                    raise ValueError(f"Unknown opcode: {opcode}")
+
+            except Exception as e:
+                message = str(e).encode("utf-8")
+                writer.write(pack_head(len(message), request_id, Opcode.ERROR))
+                writer.write(message)
+
+            await writer.drain()
+    finally:
+        writer.close()
+
+
+async def _serve(
+    index: Index,
+    host: str,
+    port: int,
+    threads: int,
+    immutable: bool,
+):
+    server = await asyncio.start_server(
+        lambda reader, writer: _serve_connection(
+            index, threads, immutable, reader, writer
+        ),
+        host=host,
+        port=port,
+    )
+    async with server:
+        await server.serve_forever()
 
 
 def serve(
     ndim_: int,
     metric: str = "ip",
+    host: str = "127.0.0.1",
     port: int = 8545,
     threads: int = 1,
     path: str = "index.usearch",
     immutable: bool = False,
 ):
-    server = Server(port=port)
     index = Index(ndim=ndim_, metric=metric)
 
     if os.path.exists(path):
@@ -42,55 +137,8 @@ def serve(
         else:
             index.load(path)
 
-    @server
-    def size() -> int:
-        return len(index)
-
-    @server
-    def ndim() -> int:
-        return index.ndim
-
-    @server
-    def capacity() -> int:
-        return index.capacity()
-
-    @server
-    def connectivity() -> int:
-        return index.connectivity()
-
-    @server
-    def add_one(key: int, vector: np.ndarray):
-        print("adding", key, vector)
-        keys = np.array([key], dtype=Key)
-        vectors = vector.flatten().reshape(vector.shape[0], 1)
-        index.add(keys, vectors)
-
-    @server
-    def add_many(keys: np.ndarray, vectors: np.ndarray):
-        index.add(keys, vectors, threads=threads)
-
-    @server
-    def search_one(vector: np.ndarray, count: int) -> List[dict]:
-        print("search", vector, count)
-        vectors = vector.reshape(vector.shape[0], 1)
-        results: Matches = index.search(vectors, count)
-        return results.to_list()
-
-    @server
-    def search_many(vectors: np.ndarray, count: int) -> List[List[dict]]:
-        results: Matches = index.search(vectors, count)
-        return results.to_list()
-
-    @server
-    def add_ascii(key: int, string: str):
-        return add_one(key, _ascii_to_vector(string))
-
-    @server
-    def search_ascii(string: str, count: int):
-        return search_one(_ascii_to_vector(string), count)
-
     try:
-        server.run()
+        asyncio.run(_serve(index, host, port, threads, immutable))
     except KeyboardInterrupt:
         if not immutable:
             index.save(path)
@@ -111,6 +159,12 @@ if __name__ == "__main__":
         choices=["ip", "cos", "l2sq", "haversine"],
         help="distance function to compare vectors",
     )
+    parser.add_argument(
+        "--host",
+        type=str,
+        default="127.0.0.1",
+        help="address to listen on for client connections",
+    )
     parser.add_argument(
         "-p",
         "--port",
@@ -130,6 +184,7 @@ if __name__ == "__main__":
     serve(
         ndim_=args.ndim,
         metric=args.metric,
+        host=args.host,
         threads=args.threads,
         port=args.port,
         path=args.path,